@@ -35,6 +35,30 @@ public:
 	static BufferedJSONReaderOptions Deserialize(Deserializer &deserializer);
 };
 
+//! The state of the scan over a top-level JSON array at a position in the file
+struct JSONArrayScanState {
+	//! Whether the file starts with a top-level array (if not, the reader of the first buffer throws an error)
+	bool is_array = true;
+	//! Whether the position is within a string
+	bool in_string = false;
+	//! Whether the position is within a string, directly after an escape character
+	bool escaped = false;
+	//! The nesting depth (within the top-level array, this is 1)
+	int64_t depth = 0;
+};
+
+//! Where the elements of a top-level JSON array are separated within a buffer, given the state at the start
+struct JSONArrayBufferSummary {
+	//! The state at the end of the buffer (the depth is relative to the start of the buffer)
+	JSONArrayScanState end_state;
+	//! The minimum relative depth before a ',' or ']' in the buffer: these are the element boundaries if the depth
+	//! is 1 within the file, otherwise the buffer is within a single element
+	int64_t boundary_depth;
+	//! The first and last ',' or ']' at the minimum depth
+	optional_idx first_boundary;
+	optional_idx last_boundary;
+};
+
 struct JSONBufferHandle {
 public:
 	JSONBufferHandle(idx_t buffer_index, idx_t readers, AllocatedData &&buffer, idx_t buffer_size);
@@ -49,6 +73,12 @@ public:
 	AllocatedData buffer;
 	//! The size of the data in the buffer (can be less than buffer.GetSize())
 	const idx_t buffer_size;
+
+	//! For JSON arrays: whether the state at the end of the buffer and the last element boundary are known.
+	//! This depends on the state at the end of the previous buffer, so the buffers are resolved in order
+	atomic<bool> array_state_resolved;
+	JSONArrayScanState array_end_state;
+	optional_idx array_last_boundary;
 };
 
 struct JSONFileHandle {
@@ -181,6 +181,11 @@ public:
 	vector<string> names;
 	vector<column_t> column_indices;
 
+	//! Filters pushed down into the scan (read_json only)
+	optional_ptr<TableFilterSet> filters;
+	//! The columns with filters are transformed first, the others only for the records that pass the filters
+	vector<column_t> filter_column_indices;
+
 	//! Buffer manager allocator
 	Allocator &allocator;
 	//! The current buffer capacity
@@ -239,10 +244,12 @@ private:
 	data_ptr_t GetReconstructBuffer(JSONScanGlobalState &gstate);
 
 	void SkipOverArrayStart();
+	void ResolveArrayBoundaries();
 
 	void ReadAndAutoDetect(JSONScanGlobalState &gstate, AllocatedData &buffer, optional_idx &buffer_index,
 	                       bool &file_done);
 	bool ReconstructFirstObject(JSONScanGlobalState &gstate);
+	bool ReconstructFirstArrayElement(JSONScanGlobalState &gstate);
 	void ParseNextChunk(JSONScanGlobalState &gstate);
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
@@ -276,6 +283,9 @@ private:
 	idx_t buffer_offset;
 	idx_t prev_buffer_remainder;
 	idx_t lines_or_objects_in_buffer;
+	//! The first and last boundary between the elements of a JSON array in the current buffer
+	optional_idx array_first_boundary;
+	optional_idx array_last_boundary;
 
 	//! Buffer to reconstruct split values
 	AllocatedData reconstruct_buffer;
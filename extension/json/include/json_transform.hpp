@@ -65,6 +65,8 @@ struct TryParseTimeStamp {
 struct JSONTransform {
 	static bool Transform(yyjson_val *vals[], yyjson_alc *alc, Vector &result, const idx_t count,
 	                      JSONTransformOptions &options);
+	//! Transforms the keys "names" of the objects into "result_vectors". Keys with a NULL result vector are not
+	//! transformed, but are not unknown keys either
 	static bool TransformObject(yyjson_val *objects[], yyjson_alc *alc, const idx_t count, const vector<string> &names,
 	                            const vector<Vector *> &result_vectors, JSONTransformOptions &options);
 	static bool GetStringVector(yyjson_val *vals[], const idx_t count, const LogicalType &target, Vector &string_vector,
@@ -375,6 +375,8 @@ bool JSONTransform::TransformObject(yyjson_val *objects[], yyjson_alc *alc, cons
 
 	idx_t found_key_count;
 	auto found_keys = JSONCommon::AllocateArray<bool>(alc, column_count);
+	// If we don't have to check the other keys, we can stop looking once we have found all of ours
+	const bool stop_when_found = !options.error_unknown_key && !options.error_duplicate_key;
 
 	bool success = true;
 
@@ -425,6 +427,9 @@ bool JSONTransform::TransformObject(yyjson_val *objects[], yyjson_alc *alc, cons
 					nested_vals[col_idx][i] = val;
 					found_keys[col_idx] = true;
 					found_key_count++;
+					if (stop_when_found && found_key_count == column_count) {
+						break;
+					}
 				}
 			} else if (success && options.error_unknown_key) {
 				options.error_message =
@@ -444,7 +449,7 @@ bool JSONTransform::TransformObject(yyjson_val *objects[], yyjson_alc *alc, cons
 				}
 				nested_vals[col_idx][i] = nullptr;
 
-				if (success && options.error_missing_key) {
+				if (success && options.error_missing_key && result_vectors[col_idx]) {
 					options.error_message = StringUtil::Format("Object %s does not have key \"" + names[col_idx] + "\"",
 					                                           JSONCommon::ValToString(objects[i], 50));
 					options.object_index = i;
@@ -455,6 +460,9 @@ bool JSONTransform::TransformObject(yyjson_val *objects[], yyjson_alc *alc, cons
 	}
 
 	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		if (!result_vectors[col_idx]) {
+			continue;
+		}
 		if (!JSONTransform::Transform(nested_vals[col_idx], alc, *result_vectors[col_idx], count, options)) {
 			success = false;
 		}
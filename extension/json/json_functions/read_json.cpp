@@ -4,6 +4,7 @@
 #include "json_structure.hpp"
 #include "json_transform.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 
 namespace duckdb {
 
@@ -317,47 +318,148 @@ unique_ptr<FunctionData> ReadJSONBind(ClientContext &context, TableFunctionBindI
 	return std::move(bind_data);
 }
 
+static void ThrowReadJSONTransformError(JSONScanGlobalState &gstate, JSONScanLocalState &lstate,
+                                        const optional_ptr<const SelectionVector> sel) {
+	string hint =
+	    gstate.bind_data.auto_detect
+	        ? "\nTry increasing 'sample_size', reducing 'maximum_depth', specifying 'columns', 'format' or "
+	          "'records' manually, setting 'ignore_errors' to true, or setting 'union_by_name' to true when "
+	          "reading multiple files with a different structure."
+	        : "\nTry setting 'auto_detect' to true, specifying 'format' or 'records' manually, or setting "
+	          "'ignore_errors' to true.";
+	auto object_index = lstate.transform_options.object_index;
+	if (sel && object_index != DConstants::INVALID_INDEX) {
+		object_index = sel->get_index(object_index);
+	}
+	lstate.ThrowTransformError(object_index, lstate.transform_options.error_message + hint);
+}
+
+//! Which of the projected columns of the records are transformed
+enum class JSONTransformedColumns : uint8_t { ALL, FILTERED, UNFILTERED };
+
+//! Transforms (some of) the projected columns of the records. The keys of the columns that are not transformed are
+//! still passed to the transform, so objects are always checked for unknown keys against all projected columns
+static void TransformRecords(JSONScanGlobalState &gstate, JSONScanLocalState &lstate, yyjson_val *values[],
+                             const idx_t count, const JSONTransformedColumns columns, DataChunk &output,
+                             const optional_ptr<const SelectionVector> sel = nullptr) {
+	vector<Vector *> result_vectors(gstate.column_indices.size(), nullptr);
+	for (idx_t i = 0; i < gstate.column_indices.size(); i++) {
+		const auto &col_idx = gstate.column_indices[i];
+		if (columns != JSONTransformedColumns::ALL) {
+			const auto filtered = gstate.filters->filters.find(col_idx) != gstate.filters->filters.end();
+			if (filtered != (columns == JSONTransformedColumns::FILTERED)) {
+				continue;
+			}
+		}
+		result_vectors[i] = &output.data[col_idx];
+	}
+	if (!JSONTransform::TransformObject(values, lstate.GetAllocator(), count, gstate.names, result_vectors,
+	                                    lstate.transform_options)) {
+		ThrowReadJSONTransformError(gstate, lstate, sel);
+	}
+}
+
+//! Transforms the columns with pushed down filters first, and the other columns only for the records that pass them
+static idx_t TransformAndFilterRecords(JSONScanGlobalState &gstate, JSONScanLocalState &lstate, const idx_t count,
+                                       DataChunk &output) {
+	TransformRecords(gstate, lstate, lstate.values, count, JSONTransformedColumns::FILTERED, output);
+
+	SelectionVector sel;
+	sel.Initialize(nullptr);
+	idx_t approved_tuple_count = count;
+	for (const auto &col_idx : gstate.filter_column_indices) {
+		auto &vector = output.data[col_idx];
+		UnifiedVectorFormat vdata;
+		vector.ToUnifiedFormat(count, vdata);
+		ColumnSegment::FilterSelection(sel, vector, vdata, *gstate.filters->filters.find(col_idx)->second, count,
+		                               approved_tuple_count);
+		if (approved_tuple_count == 0) {
+			break;
+		}
+	}
+	if (approved_tuple_count == count) {
+		TransformRecords(gstate, lstate, lstate.values, count, JSONTransformedColumns::UNFILTERED, output);
+		return count;
+	}
+
+	for (const auto &col_idx : gstate.filter_column_indices) {
+		output.data[col_idx].Slice(sel, approved_tuple_count);
+	}
+	yyjson_val *selected_values[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		selected_values[i] = lstate.values[sel.get_index(i)];
+	}
+	TransformRecords(gstate, lstate, selected_values, approved_tuple_count, JSONTransformedColumns::UNFILTERED, output,
+	                 &sel);
+	return approved_tuple_count;
+}
+
+//! Applies the pushed down filters that were not yet applied while transforming (e.g., on the filename)
+static void ApplyRemainingFilters(JSONScanGlobalState &gstate, const bool records_filtered, DataChunk &output) {
+	SelectionVector sel;
+	sel.Initialize(nullptr);
+	const auto count = output.size();
+	idx_t approved_tuple_count = count;
+	for (const auto &entry : gstate.filters->filters) {
+		if (records_filtered && std::find(gstate.filter_column_indices.begin(), gstate.filter_column_indices.end(),
+		                                  entry.first) != gstate.filter_column_indices.end()) {
+			continue;
+		}
+		auto &vector = output.data[entry.first];
+		UnifiedVectorFormat vdata;
+		vector.ToUnifiedFormat(count, vdata);
+		ColumnSegment::FilterSelection(sel, vector, vdata, *entry.second, count, approved_tuple_count);
+	}
+	if (approved_tuple_count != count) {
+		output.Slice(sel, approved_tuple_count);
+	}
+}
+
 static void ReadJSONFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &gstate = data_p.global_state->Cast<JSONGlobalTableFunctionState>().state;
 	auto &lstate = data_p.local_state->Cast<JSONLocalTableFunctionState>().state;
 
-	const auto count = lstate.ReadNext(gstate);
-	yyjson_val **values = lstate.values;
-	output.SetCardinality(count);
-
-	if (!gstate.names.empty()) {
-		vector<Vector *> result_vectors;
-		result_vectors.reserve(gstate.column_indices.size());
-		for (const auto &col_idx : gstate.column_indices) {
-			result_vectors.emplace_back(&output.data[col_idx]);
+	// Keep reading if all records of a chunk are filtered out
+	for (bool first = true;; first = false) {
+		if (!first) {
+			output.Reset();
 		}
-
-		D_ASSERT(gstate.bind_data.options.record_type != JSONRecordType::AUTO_DETECT);
-		bool success;
-		if (gstate.bind_data.options.record_type == JSONRecordType::RECORDS) {
-			success = JSONTransform::TransformObject(values, lstate.GetAllocator(), count, gstate.names, result_vectors,
-			                                         lstate.transform_options);
-		} else {
-			D_ASSERT(gstate.bind_data.options.record_type == JSONRecordType::VALUES);
-			success = JSONTransform::Transform(values, lstate.GetAllocator(), *result_vectors[0], count,
-			                                   lstate.transform_options);
+		const auto count = lstate.ReadNext(gstate);
+		yyjson_val **values = lstate.values;
+		output.SetCardinality(count);
+		if (count == 0) {
+			return;
 		}
 
-		if (!success) {
-			string hint =
-			    gstate.bind_data.auto_detect
-			        ? "\nTry increasing 'sample_size', reducing 'maximum_depth', specifying 'columns', 'format' or "
-			          "'records' manually, setting 'ignore_errors' to true, or setting 'union_by_name' to true when "
-			          "reading multiple files with a different structure."
-			        : "\nTry setting 'auto_detect' to true, specifying 'format' or 'records' manually, or setting "
-			          "'ignore_errors' to true.";
-			lstate.ThrowTransformError(lstate.transform_options.object_index,
-			                           lstate.transform_options.error_message + hint);
+		bool records_filtered = false;
+		if (!gstate.names.empty()) {
+			D_ASSERT(gstate.bind_data.options.record_type != JSONRecordType::AUTO_DETECT);
+			if (gstate.bind_data.options.record_type == JSONRecordType::RECORDS) {
+				if (gstate.filter_column_indices.empty()) {
+					TransformRecords(gstate, lstate, values, count, JSONTransformedColumns::ALL, output);
+				} else {
+					output.SetCardinality(TransformAndFilterRecords(gstate, lstate, count, output));
+					records_filtered = true;
+				}
+			} else {
+				D_ASSERT(gstate.bind_data.options.record_type == JSONRecordType::VALUES);
+				if (!JSONTransform::Transform(values, lstate.GetAllocator(), output.data[gstate.column_indices[0]],
+				                              count, lstate.transform_options)) {
+					ThrowReadJSONTransformError(gstate, lstate, nullptr);
+				}
+			}
 		}
-	}
 
-	if (output.size() != 0) {
-		MultiFileReader().FinalizeChunk(context, gstate.bind_data.reader_bind, lstate.GetReaderData(), output, nullptr);
+		if (output.size() != 0) {
+			MultiFileReader().FinalizeChunk(context, gstate.bind_data.reader_bind, lstate.GetReaderData(), output,
+			                                nullptr);
+			if (gstate.filters) {
+				ApplyRemainingFilters(gstate, records_filtered, output);
+			}
+		}
+		if (output.size() != 0) {
+			return;
+		}
 	}
 }
 
@@ -377,7 +479,8 @@ TableFunction JSONFunctions::GetReadJSONTableFunction(shared_ptr<JSONScanInfo> f
 	table_function.named_parameters["records"] = LogicalType::VARCHAR;
 	table_function.named_parameters["maximum_sample_files"] = LogicalType::BIGINT;
 
-	// TODO: might be able to do filter pushdown/prune ?
+	// Filters are evaluated on the records before the other columns are transformed
+	table_function.filter_pushdown = true;
 
 	table_function.function_info = std::move(function_info);
 
@@ -187,6 +187,16 @@ unique_ptr<GlobalTableFunctionState> JSONGlobalTableFunctionState::Init(ClientCo
 		gstate.names.push_back(bind_data.names[col_id]);
 	}
 
+	// Find the projected columns with pushed down filters
+	if (input.filters && !input.filters->filters.empty()) {
+		gstate.filters = input.filters;
+		for (const auto &col_idx : gstate.column_indices) {
+			if (input.filters->filters.find(col_idx) != input.filters->filters.end()) {
+				gstate.filter_column_indices.push_back(col_idx);
+			}
+		}
+	}
+
 	if (gstate.names.size() < bind_data.names.size() || bind_data.options.file_options.union_by_name) {
 		// If we are auto-detecting, but don't need all columns present in the file,
 		// then we don't need to throw an error if we encounter an unseen column
@@ -220,13 +230,14 @@ idx_t JSONGlobalTableFunctionState::MaxThreads() const {
 		// We opened and auto-detected a file, so we can get a better estimate
 		auto &reader = *state.json_readers[0];
 		if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED ||
-		    reader.GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+		    reader.GetFormat() == JSONFormat::NEWLINE_DELIMITED || bind_data.options.format == JSONFormat::ARRAY ||
+		    reader.GetFormat() == JSONFormat::ARRAY) {
 			return MaxValue<idx_t>(state.json_readers[0]->GetFileHandle().FileSize() / bind_data.maximum_object_size,
 			                       1);
 		}
 	}
 
-	if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED) {
+	if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED || bind_data.options.format == JSONFormat::ARRAY) {
 		// We haven't opened any files, so this is our best bet
 		return state.system_threads;
 	}
@@ -280,6 +291,15 @@ idx_t JSONScanLocalState::ReadNext(JSONScanGlobalState &gstate) {
 				if (ReconstructFirstObject(gstate)) {
 					scan_count++;
 				}
+			} else if (current_reader->GetFormat() == JSONFormat::ARRAY) {
+				if (current_buffer_handle->buffer_index == 0) {
+					SkipOverArrayStart();
+					// Elements after the last boundary are parsed by the reader of the next buffer
+					const auto region_end = array_last_boundary.IsValid() ? array_last_boundary.GetIndex() + 1 : 0;
+					buffer_size = MaxValue(buffer_offset, region_end);
+				} else if (ReconstructFirstArrayElement(gstate)) {
+					scan_count++;
+				}
 			}
 		}
 
@@ -367,6 +387,61 @@ static inline const char *NextJSON(const char *ptr, const idx_t size) {
 	return ptr == end ? nullptr : ptr;
 }
 
+//! Finds the boundaries between the elements of a top-level JSON array in a buffer, given the state at its start.
+//! The depths in the summary are relative to the depth at the start
+static JSONArrayBufferSummary SummarizeArrayBuffer(const char *const ptr, const idx_t size,
+                                                   const JSONArrayScanState &start_state) {
+	JSONArrayBufferSummary summary;
+	summary.boundary_depth = NumericLimits<int64_t>::Maximum();
+	bool in_string = start_state.in_string;
+	bool escaped = start_state.escaped;
+	int64_t depth = 0;
+	for (idx_t i = 0; i < size; i++) {
+		const auto c = ptr[i];
+		if (in_string) {
+			if (escaped) {
+				escaped = false;
+			} else if (c == '\\') {
+				escaped = true;
+			} else if (c == '"') {
+				in_string = false;
+			}
+			continue;
+		}
+		switch (c) {
+		case '"':
+			in_string = true;
+			break;
+		case '{':
+		case '[':
+			depth++;
+			break;
+		case '}':
+			depth--;
+			break;
+		case ',':
+		case ']':
+			if (depth < summary.boundary_depth) {
+				summary.boundary_depth = depth;
+				summary.first_boundary = i;
+				summary.last_boundary = i;
+			} else if (depth == summary.boundary_depth) {
+				summary.last_boundary = i;
+			}
+			if (c == ']') {
+				depth--;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	summary.end_state.in_string = in_string;
+	summary.end_state.escaped = escaped;
+	summary.end_state.depth = depth;
+	return summary;
+}
+
 static inline void TrimWhitespace(JSONString &line) {
 	while (line.size != 0 && StringUtil::CharacterIsSpace(line[0])) {
 		line.pointer++;
@@ -444,8 +519,9 @@ bool JSONScanLocalState::IsParallel(JSONScanGlobalState &gstate) const {
 		return false; // More files than threads, just parallelize over the files
 	}
 
-	// NDJSON can be read in parallel
-	return current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED;
+	// NDJSON and JSON arrays can be read in parallel
+	return current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED ||
+	       current_reader->GetFormat() == JSONFormat::ARRAY;
 }
 
 static pair<JSONFormat, JSONRecordType> DetectFormatAndRecordType(char *const buffer_ptr, const idx_t buffer_size,
@@ -542,7 +618,7 @@ bool JSONScanLocalState::ReadNextBuffer(JSONScanGlobalState &gstate) {
 	}
 
 	// Copy last bit of previous buffer
-	if (current_reader && current_reader->GetFormat() != JSONFormat::NEWLINE_DELIMITED && !is_last) {
+	if (current_reader && current_reader->GetFormat() == JSONFormat::UNSTRUCTURED && !is_last) {
 		if (!buffer.IsSet()) {
 			buffer = AllocateBuffer(gstate);
 		}
@@ -556,12 +632,6 @@ bool JSONScanLocalState::ReadNextBuffer(JSONScanGlobalState &gstate) {
 			// Try to read (if we were not the last read in the previous iteration)
 			bool file_done = false;
 			bool read_success = ReadNextBufferInternal(gstate, buffer, buffer_index, file_done);
-			if (!is_last && read_success) {
-				// We read something
-				if (buffer_index.GetIndex() == 0 && current_reader->GetFormat() == JSONFormat::ARRAY) {
-					SkipOverArrayStart();
-				}
-			}
 
 			if (file_done) {
 				lock_guard<mutex> guard(gstate.lock);
@@ -631,7 +701,8 @@ bool JSONScanLocalState::ReadNextBuffer(JSONScanGlobalState &gstate) {
 	D_ASSERT(buffer_index.IsValid());
 
 	idx_t readers = 1;
-	if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+	if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED ||
+	    current_reader->GetFormat() == JSONFormat::ARRAY) {
 		readers = is_last ? 1 : 2;
 	}
 
@@ -647,6 +718,10 @@ bool JSONScanLocalState::ReadNextBuffer(JSONScanGlobalState &gstate) {
 	// YYJSON needs this
 	memset(buffer_ptr + buffer_size, 0, YYJSON_PADDING_SIZE);
 
+	if (current_reader->GetFormat() == JSONFormat::ARRAY) {
+		ResolveArrayBoundaries();
+	}
+
 	return true;
 }
 
@@ -667,9 +742,6 @@ void JSONScanLocalState::ReadAndAutoDetect(JSONScanGlobalState &gstate, Allocate
 	if (current_reader->GetRecordType() == JSONRecordType::AUTO_DETECT) {
 		current_reader->SetRecordType(format_and_record_type.second);
 	}
-	if (current_reader->GetFormat() == JSONFormat::ARRAY) {
-		SkipOverArrayStart();
-	}
 
 	if (!bind_data.ignore_errors && bind_data.options.record_type == JSONRecordType::RECORDS &&
 	    current_reader->GetRecordType() != JSONRecordType::RECORDS) {
@@ -717,7 +789,8 @@ bool JSONScanLocalState::ReadNextBufferSeek(JSONScanGlobalState &gstate, Allocat
 		buffer_index = current_reader->GetBufferIndex();
 		is_last = read_size == 0;
 
-		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED ||
+		    current_reader->GetFormat() == JSONFormat::ARRAY) {
 			batch_index = gstate.batch_index++;
 		}
 	}
@@ -768,7 +841,8 @@ bool JSONScanLocalState::ReadNextBufferNoSeek(JSONScanGlobalState &gstate, Alloc
 		buffer_index = current_reader->GetBufferIndex();
 		is_last = read_size == 0;
 
-		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED ||
+		    current_reader->GetFormat() == JSONFormat::ARRAY) {
 			batch_index = gstate.batch_index++;
 		}
 	}
@@ -875,6 +949,143 @@ bool JSONScanLocalState::ReconstructFirstObject(JSONScanGlobalState &gstate) {
 	return true;
 }
 
+void JSONScanLocalState::ResolveArrayBoundaries() {
+	D_ASSERT(current_reader->GetFormat() == JSONFormat::ARRAY);
+	auto &handle = *current_buffer_handle;
+
+	// The state at the start of this buffer is the state at the end of the previous buffer
+	JSONArrayScanState start_state;
+	JSONArrayBufferSummary speculative_summaries[2];
+	bool speculated = false;
+	if (handle.buffer_index != 0) {
+		auto previous_buffer_handle = current_reader->GetBuffer(handle.buffer_index - 1);
+		if (!previous_buffer_handle || !previous_buffer_handle->array_state_resolved) {
+			// The previous buffer is not resolved yet: summarize this buffer for both possible states in the meantime
+			JSONArrayScanState in_string_state;
+			in_string_state.in_string = true;
+			speculative_summaries[0] = SummarizeArrayBuffer(buffer_ptr, buffer_size, JSONArrayScanState());
+			speculative_summaries[1] = SummarizeArrayBuffer(buffer_ptr, buffer_size, in_string_state);
+			speculated = true;
+			// Spinlock until the previous batch index has also resolved its buffer
+			while (!previous_buffer_handle) {
+				previous_buffer_handle = current_reader->GetBuffer(handle.buffer_index - 1);
+			}
+			while (!previous_buffer_handle->array_state_resolved) {
+				TaskScheduler::YieldThread();
+			}
+		}
+		start_state = previous_buffer_handle->array_end_state;
+	} else {
+		// The first element starts after the opening bracket
+		idx_t array_start = 0;
+		SkipWhitespace(buffer_ptr, array_start, buffer_size);
+		start_state.is_array = array_start != buffer_size && buffer_ptr[array_start] == '[';
+	}
+
+	array_first_boundary = optional_idx();
+	array_last_boundary = optional_idx();
+	if (!start_state.is_array) {
+		// Nothing to parse in the following buffers
+		handle.array_end_state = start_state;
+		handle.array_last_boundary = optional_idx();
+		handle.array_state_resolved = true;
+		return;
+	}
+
+	JSONArrayBufferSummary summary;
+	if (speculated && !start_state.escaped) {
+		summary = speculative_summaries[start_state.in_string ? 1 : 0];
+	} else {
+		// Starting directly after an escape character is rare, we only summarize for the actual state
+		summary = SummarizeArrayBuffer(buffer_ptr, buffer_size, start_state);
+	}
+
+	// The minimum depth before a ',' or ']' is 1 within the file if and only if the buffer contains element boundaries
+	if (summary.first_boundary.IsValid() && start_state.depth + summary.boundary_depth == 1) {
+		array_first_boundary = summary.first_boundary;
+		array_last_boundary = summary.last_boundary;
+	}
+
+	handle.array_end_state = summary.end_state;
+	handle.array_end_state.depth += start_state.depth;
+	handle.array_last_boundary = array_last_boundary;
+	if (handle.buffer_index == 0 && !array_last_boundary.IsValid()) {
+		// The element that is split over the buffers starts after the opening bracket
+		idx_t array_start = 0;
+		SkipWhitespace(buffer_ptr, array_start, buffer_size);
+		handle.array_last_boundary = array_start;
+	}
+	handle.array_state_resolved = true;
+}
+
+bool JSONScanLocalState::ReconstructFirstArrayElement(JSONScanGlobalState &gstate) {
+	D_ASSERT(current_buffer_handle->buffer_index != 0);
+	D_ASSERT(current_reader->GetFormat() == JSONFormat::ARRAY);
+
+	// The previous buffer is resolved, and it cannot be removed before we have read it
+	auto previous_buffer_handle = current_reader->GetBuffer(current_buffer_handle->buffer_index - 1);
+	D_ASSERT(previous_buffer_handle && previous_buffer_handle->array_state_resolved);
+
+	// The element that is split over the buffers runs from the last boundary in the previous buffer up to and
+	// including the first boundary in this buffer
+	idx_t element_size = 0;
+	const auto part2_size = array_first_boundary.IsValid() ? array_first_boundary.GetIndex() + 1 : buffer_size;
+	if (previous_buffer_handle->array_last_boundary.IsValid()) {
+		// If the previous buffer has no boundary, the element started before it, and its reader throws an error
+		auto part1_offset = previous_buffer_handle->array_last_boundary.GetIndex() + 1;
+		auto part1_size = previous_buffer_handle->buffer_size - part1_offset;
+		element_size = part1_size + part2_size;
+		if (element_size > bind_data.maximum_object_size) {
+			ThrowObjectSizeError(element_size);
+		}
+		const auto reconstruct_ptr = GetReconstructBuffer(gstate);
+		memcpy(reconstruct_ptr, previous_buffer_handle->buffer.get() + part1_offset, part1_size);
+		memcpy(reconstruct_ptr + part1_size, buffer_ptr, part2_size);
+		memset(reconstruct_ptr + element_size, 0, YYJSON_PADDING_SIZE);
+	}
+
+	// We copied the element, so we are no longer reading the previous buffer
+	if (--previous_buffer_handle->readers == 0) {
+		current_reader->RemoveBuffer(*previous_buffer_handle);
+	}
+
+	// The remaining elements of this buffer are parsed up to the last boundary
+	buffer_offset = part2_size;
+	if (array_last_boundary.IsValid()) {
+		buffer_size = array_last_boundary.GetIndex() + 1;
+	}
+
+	const auto element_ptr = char_ptr_cast(GetReconstructBuffer(gstate));
+	idx_t element_offset = 0;
+	SkipWhitespace(element_ptr, element_offset, element_size);
+	if (element_offset == element_size || element_ptr[element_offset] == ']') {
+		// Only whitespace, or the end of the array
+		return false;
+	}
+
+	auto json_start = element_ptr + element_offset;
+	idx_t remaining = element_size - element_offset;
+	auto json_end = NextJSON(json_start, remaining);
+	if (json_end == nullptr) {
+		json_end = json_start + remaining;
+	}
+	idx_t json_size = json_end - json_start;
+	ParseJSON(json_start, json_size, remaining);
+
+	element_offset += json_size;
+	SkipWhitespace(element_ptr, element_offset, element_size);
+	if (element_offset == element_size || (element_ptr[element_offset] != ',' && element_ptr[element_offset] != ']')) {
+		// We can't ignore this error, even with 'ignore_errors'
+		yyjson_read_err err;
+		err.code = YYJSON_READ_ERROR_UNEXPECTED_CHARACTER;
+		err.msg = "unexpected character";
+		err.pos = json_size;
+		current_reader->ThrowParseError(current_buffer_handle->buffer_index, lines_or_objects_in_buffer, err);
+	}
+
+	return true;
+}
+
 void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 	auto buffer_offset_before = buffer_offset;
 
@@ -890,8 +1101,8 @@ void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 		const char *json_end = format == JSONFormat::NEWLINE_DELIMITED ? NextNewline(json_start, remaining)
 		                                                               : NextJSON(json_start, remaining);
 		if (json_end == nullptr) {
-			// We reached the end of the buffer
-			if (!is_last) {
+			// We reached the end of the buffer (JSON arrays are only parsed up to the boundary of the last element)
+			if (!is_last && format != JSONFormat::ARRAY) {
 				// Last bit of data belongs to the next batch
 				if (format != JSONFormat::NEWLINE_DELIMITED) {
 					if (remaining > bind_data.maximum_object_size) {
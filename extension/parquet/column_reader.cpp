@@ -238,6 +238,7 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	offset_index.reset();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -600,8 +601,48 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (HasRepeats() || !chunk->__isset.offset_index_offset || num_values <= page_rows_available) {
+		// we can only seek to the start of a page if pages are aligned with rows
+		return num_values;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	if (!offset_index) {
+		offset_index = make_uniq<duckdb_parquet::format::OffsetIndex>();
+		trans.SetLocation(NumericCast<idx_t>(chunk->offset_index_offset));
+		reader.Read(*offset_index, *protocol);
+		trans.SetLocation(chunk_read_offset);
+	}
+	auto &page_locations = offset_index->page_locations;
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+
+	// find the last page that starts at or before the target row
+	idx_t page_idx = page_locations.size();
+	while (page_idx > 0 && NumericCast<idx_t>(page_locations[page_idx - 1].first_row_index) > target_row) {
+		page_idx--;
+	}
+	if (page_idx == 0 || NumericCast<idx_t>(page_locations[page_idx - 1].first_row_index) <= current_row) {
+		// the target row is in the current page
+		return num_values;
+	}
+	auto &page_location = page_locations[page_idx - 1];
+	if (chunk->meta_data.__isset.dictionary_page_offset &&
+	    chunk_read_offset == NumericCast<idx_t>(chunk->meta_data.dictionary_page_offset)) {
+		// we have not read anything yet - the dictionary page precedes the data pages
+		PrepareRead(none_filter);
+	}
+	auto page_start = NumericCast<idx_t>(page_location.first_row_index);
+	chunk_read_offset = NumericCast<idx_t>(page_location.offset);
+	trans.SetLocation(chunk_read_offset);
+	page_rows_available = 0;
+	group_rows_available -= page_start - current_row;
+	return target_row - page_start;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
+	num_values = SkipPages(num_values);
 
 	dummy_define.zero();
 	dummy_repeat.zero();
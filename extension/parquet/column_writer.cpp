@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -16,6 +17,7 @@
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/types/uhugeint.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #endif
 
@@ -334,6 +336,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of the page, if a column index is written for the column chunk
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -356,6 +360,8 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The distinct hashes of the values of the column chunk, if a Bloom filter is written for the column
+	unique_ptr<unordered_set<uint64_t>> bloom_filter_hashes;
 };
 
 //===--------------------------------------------------------------------===//
@@ -374,6 +380,9 @@ public:
 	//! We limit the uncompressed page size to 100MB
 	//! The max size in Parquet is 2GB, but we choose a more conservative limit
 	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
+	//! We limit the number of rows in a page of a non-repeated column, so that readers can use the page index to skip
+	//! over pages within a row group
+	static constexpr const idx_t MAX_PAGE_ROW_COUNT = 20000;
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//! For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1e9;
@@ -404,6 +413,12 @@ protected:
 
 	//! Initializes the state used to track statistics during writing. Only used for scalar types.
 	virtual unique_ptr<ColumnWriterStatistics> InitializeStatsState();
+	//! Whether or not statistics can be tracked per page, so that a column index can be written
+	virtual bool HasPageStatistics() {
+		return false;
+	}
+	//! Merges the statistics of a page into the statistics of the column chunk
+	virtual void MergeStatistics(ColumnWriterStatistics &target, ColumnWriterStatistics &source);
 
 	//! Initialize the writer for a specific page. Only used for scalar types.
 	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state);
@@ -416,6 +431,13 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Hashes the plain encoding of the values of a vector for the Bloom filter. Only used for scalar types.
+	virtual void HashVector(unordered_set<uint64_t> &hashes, Vector &vector, idx_t count);
+	//! Writes the Bloom filter of the column chunk
+	void FlushBloomFilter(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column_chunk);
+	//! Writes the page index (the column index and the offset index) of the column chunk
+	void FlushPageIndex(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column_chunk,
+	                    const duckdb_parquet::format::OffsetIndex &offset_index);
 
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
@@ -475,7 +497,8 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE ||
+			    (max_repeat == 0 && page_info.row_count >= MAX_PAGE_ROW_COUNT)) {
 				PageInformation new_info;
 				new_info.offset = page_info.offset + page_info.row_count;
 				state.page_info.push_back(new_info);
@@ -495,6 +518,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (writer.HasBloomFilter(schema_path)) {
+		state.bloom_filter_hashes = make_uniq<unordered_set<uint64_t>>();
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -520,6 +546,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		if (max_repeat == 0 && HasPageStatistics()) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -609,19 +638,33 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 		D_ASSERT(write_info.compressed_buf.get() == write_info.compressed_data);
 		write_info.temp_writer.reset();
 	}
+	if (write_info.page_stats) {
+		MergeStatistics(*state.stats_state, *write_info.page_stats);
+	}
 }
 
 unique_ptr<ColumnWriterStatistics> BasicColumnWriter::InitializeStatsState() {
 	return make_uniq<ColumnWriterStatistics>();
 }
 
+void BasicColumnWriter::MergeStatistics(ColumnWriterStatistics &target, ColumnWriterStatistics &source) {
+	throw InternalException("MergeStatistics unsupported for this column writer");
+}
+
 idx_t BasicColumnWriter::GetRowSize(const Vector &vector, const idx_t index,
                                     const BasicColumnWriterState &state) const {
 	throw InternalException("GetRowSize unsupported for struct/list column writers");
 }
 
+void BasicColumnWriter::HashVector(unordered_set<uint64_t> &hashes, Vector &vector, idx_t count) {
+	throw InternalException("HashVector unsupported for this column writer");
+}
+
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (state.bloom_filter_hashes) {
+		HashVector(*state.bloom_filter_hashes, vector, count);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -634,8 +677,8 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -682,7 +725,11 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 		column_chunk.meta_data.__isset.statistics = true;
 	}
 	for (const auto &write_info : state.write_info) {
-		column_chunk.meta_data.encodings.push_back(write_info.page_header.data_page_header.encoding);
+		auto encoding = write_info.page_header.data_page_header.encoding;
+		auto &encodings = column_chunk.meta_data.encodings;
+		if (std::find(encodings.begin(), encodings.end(), encoding) == encodings.end()) {
+			encodings.push_back(encoding);
+		}
 	}
 }
 
@@ -710,6 +757,8 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	duckdb_parquet::format::OffsetIndex offset_index;
+	idx_t first_row_index = 0;
 	for (auto &write_info : state.write_info) {
 		// set the data page offset whenever we see the *first* data page
 		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
@@ -724,10 +773,95 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_header.type == PageType::DATA_PAGE) {
+			duckdb_parquet::format::PageLocation page_location;
+			page_location.offset = UnsafeNumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    UnsafeNumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index = UnsafeNumericCast<int64_t>(first_row_index);
+			offset_index.page_locations.push_back(page_location);
+			first_row_index += write_info.max_write_count;
+		}
 	}
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+
+	if (max_repeat == 0) {
+		// pages of non-repeated columns start at row boundaries - we can write a page index
+		FlushPageIndex(state, column_chunk, offset_index);
+	}
+
+	if (state.bloom_filter_hashes) {
+		FlushBloomFilter(state, column_chunk);
+	}
+}
+
+void BasicColumnWriter::FlushPageIndex(BasicColumnWriterState &state,
+                                       duckdb_parquet::format::ColumnChunk &column_chunk,
+                                       const duckdb_parquet::format::OffsetIndex &offset_index) {
+	auto &column_writer = writer.GetWriter();
+	if (HasPageStatistics()) {
+		// the column index contains the statistics of every data page
+		duckdb_parquet::format::ColumnIndex column_index;
+		idx_t page_idx = 0;
+		for (auto &write_info : state.write_info) {
+			if (write_info.page_header.type != PageType::DATA_PAGE) {
+				continue;
+			}
+			D_ASSERT(write_info.page_stats);
+			auto &page_info = state.page_info[page_idx++];
+			int64_t null_count = 0;
+			if (!state.definition_levels.empty()) {
+				for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+					null_count += state.definition_levels[i] < max_define;
+				}
+			}
+			auto &page_stats = *write_info.page_stats;
+			bool null_page = !page_stats.HasStats();
+			column_index.null_pages.push_back(null_page);
+			column_index.min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+			column_index.max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+			column_index.null_counts.push_back(null_count);
+		}
+		column_index.__isset.null_counts = true;
+		column_index.boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+
+		auto column_index_offset = column_writer.GetTotalWritten();
+		writer.Write(column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(column_index_offset));
+		column_chunk.__set_column_index_length(
+		    NumericCast<int32_t>(column_writer.GetTotalWritten() - column_index_offset));
+	}
+	auto offset_index_offset = column_writer.GetTotalWritten();
+	writer.Write(offset_index);
+	column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset_index_offset));
+	column_chunk.__set_offset_index_length(NumericCast<int32_t>(column_writer.GetTotalWritten() - offset_index_offset));
+}
+
+void BasicColumnWriter::FlushBloomFilter(BasicColumnWriterState &state,
+                                         duckdb_parquet::format::ColumnChunk &column_chunk) {
+	// the filter is sized for the number of distinct values in the column chunk
+	auto &hashes = *state.bloom_filter_hashes;
+	ParquetBloomFilter bloom_filter(hashes.size(), ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO);
+	for (auto &hash : hashes) {
+		bloom_filter.Insert(hash);
+	}
+	state.bloom_filter_hashes.reset();
+
+	duckdb_parquet::format::BloomFilterHeader header;
+	header.numBytes = NumericCast<int32_t>(bloom_filter.Size());
+	header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+	header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+	header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+
+	auto &column_writer = writer.GetWriter();
+	auto bloom_filter_offset = column_writer.GetTotalWritten();
+	writer.Write(header);
+	writer.WriteData(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.Size()));
+	column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(bloom_filter_offset));
+	column_chunk.meta_data.__set_bloom_filter_length(
+	    NumericCast<int32_t>(column_writer.GetTotalWritten() - bloom_filter_offset));
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -797,6 +931,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+
+	void Merge(const NumericStatisticsState &other) {
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -914,12 +1057,32 @@ public:
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
+	bool HasPageStatistics() override {
+		// operators derived from the BaseParquetOperator track numeric statistics
+		return std::is_base_of<BaseParquetOperator, OP>::value;
+	}
+
+	void MergeStatistics(ColumnWriterStatistics &target, ColumnWriterStatistics &source) override {
+		using STATS = NumericStatisticsState<SRC, TGT, BaseParquetOperator>;
+		target.Cast<STATS>().Merge(source.Cast<STATS>());
+	}
+
 	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
 		auto &mask = FlatVector::Validity(input_column);
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	void HashVector(unordered_set<uint64_t> &hashes, Vector &input_column, idx_t count) override {
+		auto &mask = FlatVector::Validity(input_column);
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				hashes.insert(ParquetBloomFilter::Hash<TGT>(OP::template Operation<SRC, TGT>(ptr[r])));
+			}
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
@@ -1474,6 +1637,16 @@ public:
 		}
 	}
 
+	void HashVector(unordered_set<uint64_t> &hashes, Vector &input_column, idx_t count) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				hashes.insert(ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
+	}
+
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
 		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
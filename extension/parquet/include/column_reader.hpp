@@ -168,6 +168,9 @@ private:
 	void PreparePageV2(PageHeader &page_hdr);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
+	//! Uses the offset index of the column chunk to seek over entire pages that are skipped. Returns the number of
+	//! values that remain to be skipped within the page that we ended up at.
+	idx_t SkipPages(idx_t num_values);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
 
@@ -175,6 +178,8 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The offset index of the column chunk (if any), read when we first skip over an entire page
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
 
 	shared_ptr<ResizeableBuffer> block;
 
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/value.hpp"
+#endif
+#include "parquet_types.h"
+
+namespace duckdb {
+
+//! A split block Bloom filter (SBBF), as described in the Parquet format specification. The filter consists of a
+//! number of 256-bit blocks. Every value sets one bit in each of the eight 32-bit words of a single block.
+class ParquetBloomFilter {
+public:
+	//! The size of a single block in bytes
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! The minimum and maximum size of a filter in bytes
+	static constexpr const idx_t MIN_FILTER_SIZE = BLOCK_SIZE;
+	static constexpr const idx_t MAX_FILTER_SIZE = 128ULL * 1024ULL * 1024ULL;
+	//! The default false positive ratio that is used to size filters
+	static constexpr const double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+
+public:
+	//! Creates an empty filter that is sized for the given number of distinct values
+	ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio);
+	//! Creates a filter from a serialized bitset
+	ParquetBloomFilter(const_data_ptr_t data, idx_t size);
+
+public:
+	void Insert(uint64_t hash);
+	//! Returns false if the value with the given hash is definitely not present in the filter
+	bool FilterCheck(uint64_t hash) const;
+
+	data_ptr_t Data() {
+		return data_ptr_cast(words.data());
+	}
+	idx_t Size() const {
+		return words.size() * sizeof(uint32_t);
+	}
+
+	//! Hashes the plain encoding of a value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(T value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+	//! Hashes a constant value according to its encoding in a column with the given schema. Returns false if the
+	//! physical representation of the value in the column is not known.
+	static bool TryHashValue(const Value &value, const duckdb_parquet::format::SchemaElement &schema_ele,
+	                         uint64_t &result);
+	//! Whether or not the parquet writer can write Bloom filters for a column of the given type
+	static bool SupportsType(const LogicalType &type);
+
+private:
+	idx_t GetBlockIndex(uint64_t hash) const;
+
+private:
+	unsafe_vector<uint32_t> words;
+};
+
+} // namespace duckdb
@@ -42,6 +42,7 @@ class ClientContext;
 class BaseStatistics;
 class TableFilterSet;
 class ParquetEncryptionConfig;
+class ParquetBloomFilter;
 
 struct ParquetReaderPrefetchConfig {
 	// Percentage of data in a row group span that should be scanned for enabling whole group prefetch
@@ -64,6 +65,11 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The ranges [start, end) of rows in the current row group that can contain rows that pass the filters according
+	//! to the page index. Empty if all rows of the row group have to be scanned.
+	vector<pair<idx_t, idx_t>> row_ranges;
+	idx_t current_row_range = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -173,6 +179,8 @@ public:
 	                  const uint32_t buffer_size);
 
 	unique_ptr<BaseStatistics> ReadStatistics(const string &name);
+	//! Reads the Bloom filter of a column chunk - returns nullptr if the filter is not supported
+	unique_ptr<ParquetBloomFilter> ReadBloomFilter(const duckdb_parquet::format::ColumnChunk &column_chunk);
 	static LogicalType DeriveLogicalType(const SchemaElement &s_ele, bool binary_as_string);
 
 	FileHandle &GetHandle() {
@@ -209,6 +217,14 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	unique_ptr<ParquetBloomFilter> ReadBloomFilter(TProtocol &file_proto,
+	                                               const duckdb_parquet::format::ColumnChunk &column_chunk);
+	//! Uses the page index of the filtered columns to determine the row ranges of the current row group to scan
+	void PrepareRowRanges(ParquetReaderScanState &state);
+	//! Determines the row ranges of the pages of a column chunk that can contain rows that pass the filter - returns
+	//! false if the column chunk has no (usable) page index
+	bool GetPageRowRanges(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter,
+	                      vector<pair<idx_t, idx_t>> &result);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
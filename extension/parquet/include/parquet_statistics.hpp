@@ -18,6 +18,10 @@ struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Converts the Parquet statistics of a column chunk or of a single page (from the column index) of a leaf
+	//! column
+	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
+	                                                            const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
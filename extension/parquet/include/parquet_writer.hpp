@@ -67,7 +67,7 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, const vector<string> &bloom_filter_columns, bool debug_use_openssl);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -103,6 +103,10 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	//! Whether or not a Bloom filter should be written for the column with the given schema path
+	bool HasBloomFilter(const vector<string> &schema_path) const {
+		return schema_path.size() == 1 && bloom_filter_columns.find(schema_path[0]) != bloom_filter_columns.end();
+	}
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -125,6 +129,7 @@ private:
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
+	case_insensitive_set_t bloom_filter_columns;
 	bool debug_use_openssl;
 	shared_ptr<EncryptionUtil> encryption_util;
 
@@ -0,0 +1,164 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_parquet::format::Type;
+
+// the salts used to derive the eight bit indexes of a value within a block
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+static idx_t OptimalFilterSize(idx_t num_distinct_values, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	// the number of bits required for the given false positive ratio with eight bits set per value
+	auto num_bits =
+	    -8.0 * static_cast<double>(num_distinct_values) / std::log(1 - std::pow(false_positive_ratio, 0.125));
+	auto num_bytes = NextPowerOfTwo(static_cast<idx_t>(num_bits) / 8);
+	if (num_bytes < ParquetBloomFilter::MIN_FILTER_SIZE) {
+		return ParquetBloomFilter::MIN_FILTER_SIZE;
+	}
+	if (num_bytes > ParquetBloomFilter::MAX_FILTER_SIZE) {
+		return ParquetBloomFilter::MAX_FILTER_SIZE;
+	}
+	return num_bytes;
+}
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio) {
+	words.resize(OptimalFilterSize(num_distinct_values, false_positive_ratio) / sizeof(uint32_t), 0);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(const_data_ptr_t data, idx_t size) {
+	if (size < MIN_FILTER_SIZE || size % BLOCK_SIZE != 0) {
+		throw InvalidInputException("Invalid Parquet Bloom filter size %llu", size);
+	}
+	words.resize(size / sizeof(uint32_t));
+	memcpy(words.data(), data, size);
+}
+
+idx_t ParquetBloomFilter::GetBlockIndex(uint64_t hash) const {
+	// the upper 32 bits of the hash select the block
+	auto num_blocks = words.size() / (BLOCK_SIZE / sizeof(uint32_t));
+	return ((hash >> 32) * num_blocks) >> 32;
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto block = words.data() + GetBlockIndex(hash) * (BLOCK_SIZE / sizeof(uint32_t));
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block = words.data() + GetBlockIndex(hash) * (BLOCK_SIZE / sizeof(uint32_t));
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+bool ParquetBloomFilter::TryHashValue(const Value &value, const duckdb_parquet::format::SchemaElement &schema_ele,
+                                      uint64_t &result) {
+	if (value.IsNull()) {
+		return false;
+	}
+	// values are hashed in their plain encoding, i.e. as the physical type of the column
+	switch (value.type().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+		if (schema_ele.type != Type::INT32) {
+			return false;
+		}
+		result = Hash<int32_t>(value.GetValue<int32_t>());
+		return true;
+	case LogicalTypeId::UINTEGER:
+		if (schema_ele.type != Type::INT32) {
+			return false;
+		}
+		result = Hash<uint32_t>(UIntegerValue::Get(value));
+		return true;
+	case LogicalTypeId::DATE:
+		if (schema_ele.type != Type::INT32) {
+			return false;
+		}
+		result = Hash<int32_t>(DateValue::Get(value).days);
+		return true;
+	case LogicalTypeId::BIGINT:
+		if (schema_ele.type != Type::INT64) {
+			return false;
+		}
+		result = Hash<int64_t>(BigIntValue::Get(value));
+		return true;
+	case LogicalTypeId::UBIGINT:
+		if (schema_ele.type != Type::INT64) {
+			return false;
+		}
+		result = Hash<uint64_t>(UBigIntValue::Get(value));
+		return true;
+	case LogicalTypeId::FLOAT: {
+		auto float_value = FloatValue::Get(value);
+		// +0.0 and -0.0 (and different NaN representations) compare equal but hash differently
+		if (schema_ele.type != Type::FLOAT || float_value == 0 || Value::IsNan(float_value)) {
+			return false;
+		}
+		result = Hash<float>(float_value);
+		return true;
+	}
+	case LogicalTypeId::DOUBLE: {
+		auto double_value = DoubleValue::Get(value);
+		if (schema_ele.type != Type::DOUBLE || double_value == 0 || Value::IsNan(double_value)) {
+			return false;
+		}
+		result = Hash<double>(double_value);
+		return true;
+	}
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		if (schema_ele.type != Type::BYTE_ARRAY) {
+			return false;
+		}
+		auto &str = StringValue::Get(value);
+		result = Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetBloomFilter::SupportsType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/query_node/bound_select_node.hpp"
 #include "geo_parquet.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_metadata.hpp"
 #include "parquet_reader.hpp"
@@ -201,6 +202,9 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! The columns for which Bloom filters are written
+	vector<string> bloom_filter_columns;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -1273,6 +1277,31 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "bloom_filter_columns") {
+			auto &value = option.second[0];
+			vector<Value> column_values;
+			if (value.type().id() == LogicalTypeId::LIST) {
+				column_values = ListValue::GetChildren(value);
+			} else {
+				column_values.push_back(value);
+			}
+			for (auto &column_value : column_values) {
+				auto column_name = column_value.GetValue<string>();
+				idx_t col_idx;
+				for (col_idx = 0; col_idx < names.size(); col_idx++) {
+					if (StringUtil::CIEquals(names[col_idx], column_name)) {
+						break;
+					}
+				}
+				if (col_idx == names.size()) {
+					throw BinderException("Column \"%s\" in BLOOM_FILTER_COLUMNS not found", column_name);
+				}
+				if (!ParquetBloomFilter::SupportsType(sql_types[col_idx])) {
+					throw BinderException("Bloom filters are not supported for column \"%s\" of type \"%s\"",
+					                      column_name, sql_types[col_idx].ToString());
+				}
+				bind_data->bloom_filter_columns.push_back(names[col_idx]);
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -1302,7 +1331,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.bloom_filter_columns,
+	                             parquet_bind.debug_use_openssl);
 	return std::move(global_state);
 }
 
@@ -1426,6 +1456,7 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<vector<string>>(112, "bloom_filter_columns", bind_data.bloom_filter_columns);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1445,6 +1476,7 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithDefault<bool>(111, "debug_use_openssl", true);
+	deserializer.ReadPropertyWithDefault<vector<string>>(112, "bloom_filter_columns", data->bloom_filter_columns);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1646,6 +1678,10 @@ void ParquetExtension::Load(DuckDB &db) {
 	ParquetFileMetadataFunction file_meta_fun;
 	ExtensionUtil::RegisterFunction(db_instance, MultiFileReader::CreateFunctionSet(file_meta_fun));
 
+	// parquet_bloom_probe
+	ParquetBloomProbeFunction bloom_probe_fun;
+	ExtensionUtil::RegisterFunction(db_instance, bloom_probe_fun);
+
 	CopyFunction function("parquet");
 	function.copy_to_select = ParquetWriteSelect;
 	function.copy_to_bind = ParquetWriteBind;
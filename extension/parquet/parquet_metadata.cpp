@@ -1,5 +1,6 @@
 #include "parquet_metadata.hpp"
 
+#include "parquet_bloom_filter.hpp"
 #include "parquet_statistics.hpp"
 
 #include <sstream>
@@ -17,9 +18,19 @@ struct ParquetMetaDataBindData : public TableFunctionData {
 	vector<LogicalType> return_types;
 	unique_ptr<MultiFileList> file_list;
 	unique_ptr<MultiFileReader> multi_file_reader;
+
+	//! The column and value that are probed in the Bloom filters (parquet_bloom_probe only)
+	string probe_column_name;
+	Value probe_constant;
 };
 
-enum class ParquetMetadataOperatorType : uint8_t { META_DATA, SCHEMA, KEY_VALUE_META_DATA, FILE_META_DATA };
+enum class ParquetMetadataOperatorType : uint8_t {
+	META_DATA,
+	SCHEMA,
+	KEY_VALUE_META_DATA,
+	FILE_META_DATA,
+	BLOOM_PROBE
+};
 
 struct ParquetMetaDataOperatorData : public GlobalTableFunctionState {
 	explicit ParquetMetaDataOperatorData(ClientContext &context, const vector<LogicalType> &types)
@@ -37,11 +48,14 @@ public:
 	static void BindSchema(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindKeyValueMetaData(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindFileMetaData(vector<LogicalType> &return_types, vector<string> &names);
+	static void BindBloomProbe(vector<LogicalType> &return_types, vector<string> &names);
 
 	void LoadRowGroupMetadata(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadSchemaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadKeyValueMetaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadFileMetaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
+	void LoadBloomProbe(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path,
+	                    const string &column_name, const Value &probe);
 };
 
 template <class T>
@@ -164,6 +178,24 @@ void ParquetMetaDataOperatorData::BindMetaData(vector<LogicalType> &return_types
 
 	names.emplace_back("key_value_metadata");
 	return_types.emplace_back(LogicalType::MAP(LogicalType::BLOB, LogicalType::BLOB));
+
+	names.emplace_back("bloom_filter_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_length");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("column_index_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("column_index_length");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("offset_index_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("offset_index_length");
+	return_types.emplace_back(LogicalType::BIGINT);
 }
 
 Value ConvertParquetStats(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
@@ -298,6 +330,30 @@ void ParquetMetaDataOperatorData::LoadRowGroupMetadata(ClientContext &context, c
 			    23, count,
 			    Value::MAP(LogicalType::BLOB, LogicalType::BLOB, std::move(map_keys), std::move(map_values)));
 
+			// bloom_filter_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    24, count, ParquetElementBigint(col_meta.bloom_filter_offset, col_meta.__isset.bloom_filter_offset));
+
+			// bloom_filter_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    25, count, ParquetElementBigint(col_meta.bloom_filter_length, col_meta.__isset.bloom_filter_length));
+
+			// column_index_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    26, count, ParquetElementBigint(column.column_index_offset, column.__isset.column_index_offset));
+
+			// column_index_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    27, count, ParquetElementBigint(column.column_index_length, column.__isset.column_index_length));
+
+			// offset_index_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    28, count, ParquetElementBigint(column.offset_index_offset, column.__isset.offset_index_offset));
+
+			// offset_index_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    29, count, ParquetElementBigint(column.offset_index_length, column.__isset.offset_index_length));
+
 			count++;
 			if (count >= STANDARD_VECTOR_SIZE) {
 				current_chunk.SetCardinality(count);
@@ -560,6 +616,101 @@ void ParquetMetaDataOperatorData::LoadFileMetaData(ClientContext &context, const
 	collection.InitializeScan(scan_state);
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Probe
+//===--------------------------------------------------------------------===//
+void ParquetMetaDataOperatorData::BindBloomProbe(vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("file_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("row_group_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_excludes");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+}
+
+//! Returns the index of the column chunk of a top-level column - or DConstants::INVALID_INDEX for nested columns
+static idx_t GetBloomProbeColumnChunk(const duckdb_parquet::format::FileMetaData &meta_data, const string &file_path,
+                                      const string &column_name, idx_t &schema_idx) {
+	idx_t column_chunk_idx = 0;
+	idx_t next_schema_idx = 1;
+	for (int32_t child_idx = 0; child_idx < meta_data.schema[0].num_children; child_idx++) {
+		if (next_schema_idx >= meta_data.schema.size()) {
+			break;
+		}
+		auto &schema_element = meta_data.schema[next_schema_idx];
+		bool is_leaf = schema_element.num_children == 0;
+		if (StringUtil::CIEquals(schema_element.name, column_name)) {
+			schema_idx = next_schema_idx;
+			return is_leaf ? column_chunk_idx : DConstants::INVALID_INDEX;
+		}
+		// skip over the (nested) column
+		idx_t remaining = 1;
+		while (remaining > 0 && next_schema_idx < meta_data.schema.size()) {
+			auto &element = meta_data.schema[next_schema_idx++];
+			remaining--;
+			if (element.num_children > 0) {
+				remaining += NumericCast<idx_t>(element.num_children);
+			} else {
+				column_chunk_idx++;
+			}
+		}
+	}
+	throw InvalidInputException("Column \"%s\" not found in Parquet file \"%s\"", column_name, file_path);
+}
+
+void ParquetMetaDataOperatorData::LoadBloomProbe(ClientContext &context, const vector<LogicalType> &return_types,
+                                                 const string &file_path, const string &column_name,
+                                                 const Value &probe) {
+	collection.Reset();
+	ParquetOptions parquet_options(context);
+	auto reader = make_uniq<ParquetReader>(context, file_path, parquet_options);
+	idx_t count = 0;
+	DataChunk current_chunk;
+	current_chunk.Initialize(context, return_types);
+	auto meta_data = reader->GetFileMetadata();
+
+	idx_t schema_idx = 0;
+	auto column_chunk_idx = GetBloomProbeColumnChunk(*meta_data, file_path, column_name, schema_idx);
+	auto &schema_element = meta_data->schema[schema_idx];
+
+	// hash the probe value as it would be stored in the column
+	uint64_t hash = 0;
+	bool can_probe = false;
+	if (column_chunk_idx != DConstants::INVALID_INDEX && !probe.IsNull()) {
+		auto column_type = ParquetReader::DeriveLogicalType(schema_element, parquet_options.binary_as_string);
+		can_probe = ParquetBloomFilter::TryHashValue(probe.DefaultCastAs(column_type), schema_element, hash);
+	}
+
+	for (idx_t row_group_idx = 0; row_group_idx < meta_data->row_groups.size(); row_group_idx++) {
+		auto &row_group = meta_data->row_groups[row_group_idx];
+
+		bool excludes = false;
+		if (can_probe && column_chunk_idx < row_group.columns.size() &&
+		    row_group.columns[column_chunk_idx].meta_data.__isset.bloom_filter_offset) {
+			auto bloom_filter = reader->ReadBloomFilter(row_group.columns[column_chunk_idx]);
+			excludes = bloom_filter && !bloom_filter->FilterCheck(hash);
+		}
+
+		current_chunk.SetValue(0, count, Value(file_path));
+		current_chunk.SetValue(1, count, Value::BIGINT(UnsafeNumericCast<int64_t>(row_group_idx)));
+		current_chunk.SetValue(2, count, Value::BOOLEAN(excludes));
+
+		count++;
+		if (count >= STANDARD_VECTOR_SIZE) {
+			current_chunk.SetCardinality(count);
+			collection.Append(current_chunk);
+
+			count = 0;
+			current_chunk.Reset();
+		}
+	}
+	current_chunk.SetCardinality(count);
+	collection.Append(current_chunk);
+	collection.InitializeScan(scan_state);
+}
+
 //===--------------------------------------------------------------------===//
 // Bind
 //===--------------------------------------------------------------------===//
@@ -579,6 +730,9 @@ unique_ptr<FunctionData> ParquetMetaDataBind(ClientContext &context, TableFuncti
 	case ParquetMetadataOperatorType::FILE_META_DATA:
 		ParquetMetaDataOperatorData::BindFileMetaData(return_types, names);
 		break;
+	case ParquetMetadataOperatorType::BLOOM_PROBE:
+		ParquetMetaDataOperatorData::BindBloomProbe(return_types, names);
+		break;
 	default:
 		throw InternalException("Unsupported ParquetMetadataOperatorType");
 	}
@@ -587,6 +741,13 @@ unique_ptr<FunctionData> ParquetMetaDataBind(ClientContext &context, TableFuncti
 	result->return_types = return_types;
 	result->multi_file_reader = MultiFileReader::Create(input.table_function);
 	result->file_list = result->multi_file_reader->CreateFileList(context, input.inputs[0]);
+	if (TYPE == ParquetMetadataOperatorType::BLOOM_PROBE) {
+		if (input.inputs[1].IsNull()) {
+			throw BinderException("parquet_bloom_probe: the column name cannot be NULL");
+		}
+		result->probe_column_name = StringValue::Get(input.inputs[1]);
+		result->probe_constant = input.inputs[2];
+	}
 	return std::move(result);
 }
 
@@ -614,6 +775,10 @@ unique_ptr<GlobalTableFunctionState> ParquetMetaDataInit(ClientContext &context,
 	case ParquetMetadataOperatorType::FILE_META_DATA:
 		result->LoadFileMetaData(context, bind_data.return_types, bind_data.file_list->GetFirstFile());
 		break;
+	case ParquetMetadataOperatorType::BLOOM_PROBE:
+		result->LoadBloomProbe(context, bind_data.return_types, bind_data.file_list->GetFirstFile(),
+		                       bind_data.probe_column_name, bind_data.probe_constant);
+		break;
 	default:
 		throw InternalException("Unsupported ParquetMetadataOperatorType");
 	}
@@ -647,6 +812,10 @@ void ParquetMetaDataImplementation(ClientContext &context, TableFunctionInput &d
 			case ParquetMetadataOperatorType::FILE_META_DATA:
 				data.LoadFileMetaData(context, bind_data.return_types, data.current_file);
 				break;
+			case ParquetMetadataOperatorType::BLOOM_PROBE:
+				data.LoadBloomProbe(context, bind_data.return_types, data.current_file, bind_data.probe_column_name,
+				                    bind_data.probe_constant);
+				break;
 			default:
 				throw InternalException("Unsupported ParquetMetadataOperatorType");
 			}
@@ -686,4 +855,11 @@ ParquetFileMetadataFunction::ParquetFileMetadataFunction()
                     ParquetMetaDataInit<ParquetMetadataOperatorType::FILE_META_DATA>) {
 }
 
+ParquetBloomProbeFunction::ParquetBloomProbeFunction()
+    : TableFunction("parquet_bloom_probe", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::ANY},
+                    ParquetMetaDataImplementation<ParquetMetadataOperatorType::BLOOM_PROBE>,
+                    ParquetMetaDataBind<ParquetMetadataOperatorType::BLOOM_PROBE>,
+                    ParquetMetaDataInit<ParquetMetadataOperatorType::BLOOM_PROBE>) {
+}
+
 } // namespace duckdb
@@ -8,6 +8,7 @@
 #include "expression_column_reader.hpp"
 #include "geo_parquet.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -26,6 +27,7 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -717,6 +719,69 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 	}
 }
 
+//! Returns false if no value that passes the filter can be present in the column chunk
+static bool CheckParquetBloomFilter(const ParquetBloomFilter &bloom_filter, const ColumnReader &column_reader,
+                                    TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    constant_filter.constant.type() != column_reader.Type() ||
+		    !ParquetBloomFilter::TryHashValue(constant_filter.constant, column_reader.Schema(), hash)) {
+			return true;
+		}
+		return bloom_filter.FilterCheck(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (!CheckParquetBloomFilter(bloom_filter, column_reader, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (CheckParquetBloomFilter(bloom_filter, column_reader, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true;
+	}
+}
+
+unique_ptr<ParquetBloomFilter> ParquetReader::ReadBloomFilter(const duckdb_parquet::format::ColumnChunk &column_chunk) {
+	auto file_proto = CreateThriftFileProtocol(allocator, *file_handle, false);
+	return ReadBloomFilter(*file_proto, column_chunk);
+}
+
+unique_ptr<ParquetBloomFilter> ParquetReader::ReadBloomFilter(TProtocol &file_proto,
+                                                              const duckdb_parquet::format::ColumnChunk &column_chunk) {
+	auto &meta_data = column_chunk.meta_data;
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto.getTransport());
+	transport.SetLocation(NumericCast<idx_t>(meta_data.bloom_filter_offset));
+
+	duckdb_parquet::format::BloomFilterHeader header;
+	Read(header, file_proto);
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+		return nullptr;
+	}
+	if (header.numBytes < NumericCast<int32_t>(ParquetBloomFilter::MIN_FILTER_SIZE) ||
+	    header.numBytes % NumericCast<int32_t>(ParquetBloomFilter::BLOCK_SIZE) != 0) {
+		throw InvalidInputException("Invalid Bloom filter size %d in Parquet file \"%s\"", header.numBytes,
+		                            file_name);
+	}
+	auto bitset = allocator.Allocate(NumericCast<idx_t>(header.numBytes));
+	ReadData(file_proto, bitset.get(), NumericCast<uint32_t>(header.numBytes));
+	return make_uniq<ParquetBloomFilter>(bitset.get(), bitset.GetSize());
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -763,6 +828,15 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
+			} else if (!column_reader->Type().IsNested() && column_reader->FileIdx() < group.columns.size() &&
+			           group.columns[column_reader->FileIdx()].meta_data.__isset.bloom_filter_offset) {
+				// the min/max statistics cannot exclude equality filters on high-cardinality columns
+				// if the column chunk has a Bloom filter we can check whether the values are present
+				// nested columns (e.g. structs) do not have a column chunk of their own
+				auto bloom_filter = ReadBloomFilter(*state.thrift_file_proto, group.columns[column_reader->FileIdx()]);
+				if (bloom_filter && !CheckParquetBloomFilter(*bloom_filter, *column_reader, filter)) {
+					skip_chunk = true;
+				}
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -776,6 +850,119 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+bool ParquetReader::GetPageRowRanges(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter,
+                                     vector<pair<idx_t, idx_t>> &result) {
+	auto &group = GetGroup(state);
+	if (column_reader.MaxRepeat() > 0 || column_reader.Type().IsNested() ||
+	    column_reader.FileIdx() >= group.columns.size()) {
+		return false;
+	}
+	auto &column_chunk = group.columns[column_reader.FileIdx()];
+	if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+		return false;
+	}
+	if (!column_reader.Stats(state.group_idx_list[state.current_group], group.columns)) {
+		// we cannot convert the statistics of this column (e.g. because of a cast)
+		return false;
+	}
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	duckdb_parquet::format::ColumnIndex column_index;
+	transport.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+	Read(column_index, *state.thrift_file_proto);
+	duckdb_parquet::format::OffsetIndex offset_index;
+	transport.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+	Read(offset_index, *state.thrift_file_proto);
+
+	auto &page_locations = offset_index.page_locations;
+	auto page_count = page_locations.size();
+	if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+	    column_index.max_values.size() != page_count) {
+		throw InvalidInputException("Page index of column \"%s\" in Parquet file \"%s\" is corrupt",
+		                            column_reader.Schema().name, file_name);
+	}
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+		auto page_end =
+		    page_idx + 1 < page_count ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index) : group_rows;
+		if (!column_index.null_pages[page_idx]) {
+			duckdb_parquet::format::Statistics page_stats;
+			page_stats.__set_min_value(column_index.min_values[page_idx]);
+			page_stats.__set_max_value(column_index.max_values[page_idx]);
+			if (column_index.__isset.null_counts && column_index.null_counts.size() == page_count) {
+				page_stats.__set_null_count(column_index.null_counts[page_idx]);
+			}
+			auto stats = ParquetStatisticsUtils::TransformColumnStatistics(column_reader, page_stats);
+			if (stats && filter.CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+		}
+		if (!result.empty() && result.back().second == page_start) {
+			// merge with the previous page
+			result.back().second = page_end;
+		} else {
+			result.emplace_back(page_start, page_end);
+		}
+	}
+	return true;
+}
+
+static vector<pair<idx_t, idx_t>> IntersectRowRanges(const vector<pair<idx_t, idx_t>> &left,
+                                                     const vector<pair<idx_t, idx_t>> &right) {
+	vector<pair<idx_t, idx_t>> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() && right_idx < right.size()) {
+		auto start = MaxValue<idx_t>(left[left_idx].first, right[right_idx].first);
+		auto end = MinValue<idx_t>(left[left_idx].second, right[right_idx].second);
+		if (start < end) {
+			result.emplace_back(start, end);
+		}
+		if (left[left_idx].second < right[right_idx].second) {
+			left_idx++;
+		} else {
+			right_idx++;
+		}
+	}
+	return result;
+}
+
+void ParquetReader::PrepareRowRanges(ParquetReaderScanState &state) {
+	state.row_ranges.clear();
+	state.current_row_range = 0;
+
+	auto &group = GetGroup(state);
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	if (!reader_data.filters || state.group_offset >= group_rows) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	vector<pair<idx_t, idx_t>> row_ranges;
+	row_ranges.emplace_back(0, group_rows);
+	for (auto &filter_col : reader_data.filters->filters) {
+		auto &filter_entry = reader_data.filter_map[filter_col.first];
+		if (filter_entry.is_constant) {
+			continue;
+		}
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+		vector<pair<idx_t, idx_t>> page_ranges;
+		if (!GetPageRowRanges(state, *column_reader, *filter_col.second, page_ranges)) {
+			continue;
+		}
+		row_ranges = IntersectRowRanges(row_ranges, page_ranges);
+		if (row_ranges.empty()) {
+			// no page can contain rows that pass the filter - skip the entire row group
+			state.group_offset = group_rows;
+			return;
+		}
+	}
+	if (row_ranges.size() == 1 && row_ranges[0].first == 0 && row_ranges[0].second == group_rows) {
+		// we need to scan all rows
+		return;
+	}
+	state.row_ranges = std::move(row_ranges);
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -852,6 +1039,22 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+void FilterBloom(Vector &v, const BloomFilter &bloom_filter, parquet_filter_t &filter_mask, idx_t count) {
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t approved_tuple_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_tuple_count++, i);
+		}
+	}
+	bloom_filter.Filter(v, sel, approved_tuple_count);
+
+	filter_mask.reset();
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -994,6 +1197,9 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterBloom(v, filter.Cast<BloomFilter>(), filter_mask, count);
+		break;
 	default:
 		D_ASSERT(0);
 		break;
@@ -1037,9 +1243,11 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrepareRowRanges(state);
 
 		auto &group = GetGroup(state);
-		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
+		// if the page index restricts the rows we read, we only fetch the pages that we actually read
+		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows && state.row_ranges.empty()) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
 
@@ -1088,6 +1296,29 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
+	if (!state.row_ranges.empty()) {
+		// skip over the rows in between the row ranges that can contain rows that pass the filters
+		while (state.current_row_range < state.row_ranges.size() &&
+		       state.group_offset >= state.row_ranges[state.current_row_range].second) {
+			state.current_row_range++;
+		}
+		if (state.current_row_range == state.row_ranges.size()) {
+			// no more rows in this row group can pass the filters
+			state.group_offset = GetGroup(state).num_rows;
+			result.SetCardinality(0);
+			return true;
+		}
+		auto range_start = state.row_ranges[state.current_row_range].first;
+		if (state.group_offset < range_start) {
+			auto skip_count = range_start - state.group_offset;
+			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset = range_start;
+		}
+	}
+
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
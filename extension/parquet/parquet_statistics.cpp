@@ -320,7 +320,13 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformColumnStatistics(reader, column_chunk.meta_data.statistics);
+}
+
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformColumnStatistics(const ColumnReader &reader,
+                                                  const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
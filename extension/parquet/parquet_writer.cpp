@@ -319,10 +319,11 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
+                             const vector<string> &bloom_filter_columns_p, bool debug_use_openssl_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
+      bloom_filter_columns(bloom_filter_columns_p.begin(), bloom_filter_columns_p.end()),
       debug_use_openssl(debug_use_openssl_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
@@ -14,6 +14,7 @@
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/common/extra_type_info.hpp"
 #include "duckdb/parser/expression/cast_expression.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
 
 #include <sstream>
 
@@ -21,7 +22,7 @@ namespace duckdb {
 
 TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
-      constraints(std::move(info.constraints)) {
+      constraints(std::move(info.constraints)), sort_keys(info.sort_keys) {
 	this->temporary = info.temporary;
 	this->dependencies = info.dependencies;
 	this->comment = info.comment;
@@ -71,6 +72,7 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
 	result->comment = comment;
 	result->tags = tags;
+	result->sort_keys = sort_keys;
 	return std::move(result);
 }
 
@@ -176,6 +178,13 @@ string TableCatalogEntry::ColumnsToSQL(const ColumnList &columns, const vector<u
 	return ss.str();
 }
 
+string TableCatalogEntry::SortKeysToSQL(const vector<string> &sort_keys) {
+	if (sort_keys.empty()) {
+		return string();
+	}
+	return " WITH (order_by = " + KeywordHelper::WriteQuoted(StringUtil::Join(sort_keys, ", "), '\'') + ")";
+}
+
 string TableCatalogEntry::ToSQL() const {
 	auto create_info = GetInfo();
 	return create_info->ToString();
@@ -193,6 +202,10 @@ const vector<unique_ptr<Constraint>> &TableCatalogEntry::GetConstraints() const
 	return constraints;
 }
 
+const vector<string> &TableCatalogEntry::GetSortKeys() const {
+	return sort_keys;
+}
+
 // LCOV_EXCL_START
 DataTable &TableCatalogEntry::GetStorage() {
 	throw InternalException("Calling GetStorage on a TableCatalogEntry that is not a DuckTableEntry");
@@ -375,6 +375,12 @@ bool FileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes
 	return false;
 }
 
+void FileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	for (auto &request : requests) {
+		Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+}
+
 void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	throw NotImplementedException("%s: Write (with location) is not implemented!", GetName());
 }
@@ -573,6 +579,10 @@ void FileHandle::Read(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
 
+void FileHandle::ReadBatch(vector<FileReadRequest> &requests) {
+	file_system.ReadBatch(*this, requests);
+}
+
 void FileHandle::Write(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
@@ -460,6 +460,24 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+#if defined(__linux__)
+	if (requests.size() > 1) {
+		// ask the kernel to start reading all ranges asynchronously - this puts all reads in flight at the same time,
+		// after which the reads below are (partially) served from the page cache
+		// this is only a hint: failures are ignored, and it has no effect for files opened with direct I/O
+		int fd = handle.Cast<UnixFileHandle>().fd;
+		for (auto &request : requests) {
+			posix_fadvise(fd, UnsafeNumericCast<off_t>(request.location), UnsafeNumericCast<off_t>(request.nr_bytes),
+			              POSIX_FADV_WILLNEED);
+		}
+	}
+#endif
+	for (auto &request : requests) {
+		Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	int64_t bytes_read = read(fd, buffer, UnsafeNumericCast<size_t>(nr_bytes));
@@ -958,6 +976,10 @@ int64_t LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_byte
 	return bytes_written;
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	FileSystem::ReadBatch(handle, requests);
+}
+
 bool LocalFileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) {
 	// TODO: Not yet implemented on windows.
 	return false;
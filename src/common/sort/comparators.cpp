@@ -7,7 +7,8 @@
 namespace duckdb {
 
 bool Comparators::TieIsBreakable(const idx_t &tie_col, const data_ptr_t &row_ptr, const SortLayout &sort_layout) {
-	const auto &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
+	const auto &col_idx = sort_layout.sorting_to_blob_col[tie_col];
+	D_ASSERT(col_idx != DConstants::INVALID_INDEX);
 	// Check if the blob is NULL
 	ValidityBytes row_mask(row_ptr);
 	idx_t entry_idx;
@@ -51,10 +52,11 @@ int Comparators::CompareTuple(const SBScanState &left, const SBScanState &right,
 	return comp_res;
 }
 
-int Comparators::CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type) {
+int Comparators::CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type,
+                            const idx_t prefix_len) {
 	switch (type.InternalType()) {
 	case PhysicalType::VARCHAR:
-		return TemplatedCompareVal<string_t>(l_ptr, r_ptr);
+		return CompareStringVal(l_ptr, r_ptr, prefix_len);
 	case PhysicalType::LIST:
 	case PhysicalType::ARRAY:
 	case PhysicalType::STRUCT: {
@@ -76,13 +78,14 @@ int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, con
 		return 0;
 	}
 	// Align the pointers
-	const idx_t &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
+	const idx_t &col_idx = sort_layout.sorting_to_blob_col[tie_col];
 	const auto &tie_col_offset = sort_layout.blob_layout.GetOffsets()[col_idx];
 	l_data_ptr += tie_col_offset;
 	r_data_ptr += tie_col_offset;
 	// Do the comparison
 	const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
 	const auto &type = sort_layout.blob_layout.GetTypes()[col_idx];
+	const auto &prefix_len = sort_layout.prefix_lengths[tie_col];
 	int result;
 	if (external) {
 		// Store heap pointers
@@ -92,12 +95,12 @@ int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, con
 		UnswizzleSingleValue(l_data_ptr, l_heap_ptr, type);
 		UnswizzleSingleValue(r_data_ptr, r_heap_ptr, type);
 		// Compare
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
+		result = CompareVal(l_data_ptr, r_data_ptr, type, prefix_len);
 		// Swizzle the pointers back to offsets
 		SwizzleSingleValue(l_data_ptr, l_heap_ptr, type);
 		SwizzleSingleValue(r_data_ptr, r_heap_ptr, type);
 	} else {
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
+		result = CompareVal(l_data_ptr, r_data_ptr, type, prefix_len);
 	}
 	return order * result;
 }
@@ -115,6 +118,25 @@ int Comparators::TemplatedCompareVal(const data_ptr_t &left_ptr, const data_ptr_
 	}
 }
 
+int Comparators::CompareStringVal(const data_ptr_t &left_ptr, const data_ptr_t &right_ptr, const idx_t &prefix_len) {
+	const auto left_val = Load<string_t>(left_ptr);
+	const auto right_val = Load<string_t>(right_ptr);
+	const auto left_size = left_val.GetSize();
+	const auto right_size = right_val.GetSize();
+	if (left_size < prefix_len || right_size < prefix_len) {
+		// The prefix may have been padded, compare the full strings
+		return TemplatedCompareVal<string_t>(left_ptr, right_ptr);
+	}
+	// Long strings often share a prefix (e.g., URLs), skip the bytes that were already compared
+	const auto min_size = MinValue(left_size, right_size);
+	const auto comp_res =
+	    memcmp(left_val.GetData() + prefix_len, right_val.GetData() + prefix_len, min_size - prefix_len);
+	if (comp_res != 0) {
+		return comp_res < 0 ? -1 : 1;
+	}
+	return left_size == right_size ? 0 : (left_size < right_size ? -1 : 1);
+}
+
 int Comparators::CompareValAndAdvance(data_ptr_t &l_ptr, data_ptr_t &r_ptr, const LogicalType &type, bool valid) {
 	switch (type.InternalType()) {
 	case PhysicalType::BOOL:
@@ -116,6 +116,7 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 		entry_size = AlignValue(entry_size);
 	}
 
+	sorting_to_blob_col.resize(column_count, DConstants::INVALID_INDEX);
 	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
 		all_constant = all_constant && constant_size[col_idx];
 		if (!constant_size[col_idx]) {
@@ -0,0 +1,62 @@
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t expected_count) {
+	auto bit_count = NextPowerOfTwo(MaxValue<idx_t>(expected_count * BITS_PER_KEY, 64));
+	block_count = MinValue<idx_t>(bit_count / 64, MAXIMUM_BLOCK_COUNT);
+	bitmask = block_count - 1;
+	blocks = make_unsafe_uniq_array<uint64_t>(block_count);
+}
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t block_count_p, unsafe_unique_array<uint64_t> blocks_p)
+    : block_count(block_count_p), bitmask(block_count_p - 1), blocks(std::move(blocks_p)) {
+	D_ASSERT(IsPowerOfTwo(block_count));
+}
+
+void BlockedBloomFilter::Insert(const hash_t *hashes, idx_t count) {
+	auto atomic_blocks = reinterpret_cast<atomic<uint64_t> *>(blocks.get());
+	for (idx_t i = 0; i < count; i++) {
+		const auto mask = GetMask(hashes[i]);
+		auto &block = atomic_blocks[hashes[i] & bitmask];
+		// avoid the (contended) read-modify-write if all bits are already set
+		if ((block.load(std::memory_order_relaxed) & mask) != mask) {
+			block.fetch_or(mask, std::memory_order_relaxed);
+		}
+	}
+}
+
+idx_t BlockedBloomFilter::Lookup(Vector &hashes, const SelectionVector &sel, idx_t count,
+                                 SelectionVector &result) const {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		auto hash = hash_data[hdata.sel->get_index(idx)];
+		result.set_index(result_count, idx);
+		result_count += Lookup(hash);
+	}
+	return result_count;
+}
+
+void BlockedBloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<idx_t>(100, "block_count", block_count);
+	serializer.WriteProperty(101, "blocks", const_data_ptr_cast(blocks.get()), SizeInBytes());
+}
+
+shared_ptr<BlockedBloomFilter> BlockedBloomFilter::Deserialize(Deserializer &deserializer) {
+	auto block_count = deserializer.ReadProperty<idx_t>(100, "block_count");
+	auto blocks = make_unsafe_uniq_array_uninitialized<uint64_t>(block_count);
+	deserializer.ReadProperty(101, "blocks", data_ptr_cast(blocks.get()), block_count * sizeof(uint64_t));
+	return make_shared_ptr<BlockedBloomFilter>(block_count, std::move(blocks));
+}
+
+} // namespace duckdb
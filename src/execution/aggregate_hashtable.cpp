@@ -41,7 +41,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), skip_lookups(false), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -140,6 +141,9 @@ idx_t GroupedAggregateHashTable::ApplyBitMask(hash_t hash) const {
 
 void GroupedAggregateHashTable::Verify() {
 #ifdef DEBUG
+	if (skip_lookups) {
+		return; // The pointer table is not used
+	}
 	idx_t total_count = 0;
 	for (idx_t i = 0; i < capacity; i++) {
 		const auto &entry = entries[i];
@@ -162,6 +166,14 @@ void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
 }
 
+void GroupedAggregateHashTable::SkipLookups() {
+	skip_lookups = true;
+}
+
+bool GroupedAggregateHashTable::SkipsLookups() const {
+	return skip_lookups;
+}
+
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
@@ -313,8 +325,8 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(addresses_v.GetType() == LogicalType::POINTER);
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
-	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	// Need to fit the entire vector, and resize at threshold (the pointer table is not used when skipping lookups)
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
@@ -359,6 +371,22 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Every row becomes a new group, duplicate groups are combined when the partitions are finalized
+		const auto group_count = groups.size();
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, *sel_vector, group_count);
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, *sel_vector, group_count);
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t i = 0; i < group_count; i++) {
+			addresses[i] = row_locations[row_sel.get_index(i)];
+			new_groups_out.set_index(i, i);
+		}
+		count += group_count;
+		return group_count;
+	}
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
@@ -1,5 +1,6 @@
 #include "duckdb/execution/index/art/art.hpp"
 
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -848,6 +849,78 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 	return nullptr;
 }
 
+static void PrefetchNode(ART &art, const Node &node) {
+	auto type = node.GetType();
+	if (type == NType::LEAF_INLINED) {
+		// the row ID is stored in the pointer itself
+		return;
+	}
+	PrefetchForRead(Node::GetAllocator(art, type).Get<const data_t>(node, false));
+}
+
+void ART::BatchLookup(const vector<ARTKey> &keys, const idx_t count, vector<optional_ptr<const Node>> &leaves) {
+	D_ASSERT(count <= keys.size());
+	leaves.assign(count, nullptr);
+	if (!tree.HasMetadata()) {
+		return;
+	}
+
+	// the current node and depth of each lookup that has not finished yet
+	vector<idx_t> active;
+	vector<reference<const Node>> nodes;
+	vector<idx_t> depths;
+	active.reserve(count);
+	nodes.reserve(count);
+	depths.reserve(count);
+	for (idx_t i = 0; i < count; i++) {
+		if (keys[i].Empty()) {
+			continue;
+		}
+		active.push_back(i);
+		nodes.emplace_back(tree);
+		depths.push_back(0);
+	}
+
+	// advance all lookups by one level per round: while one lookup waits on its prefetched node, the others proceed
+	while (!active.empty()) {
+		idx_t active_count = 0;
+		for (idx_t i = 0; i < active.size(); i++) {
+			auto &key = keys[active[i]];
+			auto depth = depths[i];
+
+			// traverse prefix, if exists
+			reference<const Node> next_node(nodes[i].get());
+			if (next_node.get().GetType() == NType::PREFIX) {
+				Prefix::Traverse(*this, next_node, key, depth);
+				if (next_node.get().GetType() == NType::PREFIX) {
+					continue;
+				}
+			}
+			if (next_node.get().GetType() == NType::LEAF || next_node.get().GetType() == NType::LEAF_INLINED) {
+				leaves[active[i]] = &next_node.get();
+				continue;
+			}
+
+			D_ASSERT(depth < key.len);
+			auto child = next_node.get().GetChild(*this, key[depth]);
+			if (!child) {
+				continue;
+			}
+			D_ASSERT(child->HasMetadata());
+			PrefetchNode(*this, *child);
+
+			// the lookup continues in the next round
+			active[active_count] = active[i];
+			nodes[active_count] = *child;
+			depths[active_count] = depth + 1;
+			active_count++;
+		}
+		active.resize(active_count);
+		nodes.erase(nodes.begin() + NumericCast<int64_t>(active_count), nodes.end());
+		depths.resize(active_count);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Greater Than and Less Than
 //===--------------------------------------------------------------------===//
@@ -1052,6 +1125,9 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	vector<ARTKey> keys(expression_chunk.size());
 	GenerateKeys<>(arena_allocator, expression_chunk, keys);
 
+	vector<optional_ptr<const Node>> leaves;
+	BatchLookup(keys, input.size(), leaves);
+
 	idx_t found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 
@@ -1062,7 +1138,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 			continue;
 		}
 
-		auto leaf = Lookup(tree, keys[i], 0);
+		auto leaf = leaves[i];
 		if (!leaf) {
 			if (conflict_manager.AddMiss(i)) {
 				found_conflict = i;
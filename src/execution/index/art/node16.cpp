@@ -1,6 +1,7 @@
 #include "duckdb/execution/index/art/node16.hpp"
 #include "duckdb/execution/index/art/node4.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
+#include "duckdb/execution/index/art/node_byte_search.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 
 namespace duckdb {
@@ -109,13 +110,7 @@ void Node16::DeleteChild(ART &art, Node &node, const uint8_t byte) {
 	D_ASSERT(node.HasMetadata());
 	auto &n16 = Node::RefMutable<Node16>(art, node, NType::NODE_16);
 
-	idx_t child_pos = 0;
-	for (; child_pos < n16.count; child_pos++) {
-		if (n16.key[child_pos] == byte) {
-			break;
-		}
-	}
-
+	auto child_pos = NodeByteSearch::FindEqual(n16.key, n16.count, byte);
 	D_ASSERT(child_pos < n16.count);
 
 	// free the child and decrease the count
@@ -136,52 +131,47 @@ void Node16::DeleteChild(ART &art, Node &node, const uint8_t byte) {
 }
 
 void Node16::ReplaceChild(const uint8_t byte, const Node child) {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] == byte) {
-			children[i] = child;
-			return;
-		}
+	auto child_pos = NodeByteSearch::FindEqual(key, count, byte);
+	if (child_pos < count) {
+		children[child_pos] = child;
 	}
 }
 
 optional_ptr<const Node> Node16::GetChild(const uint8_t byte) const {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] == byte) {
-			D_ASSERT(children[i].HasMetadata());
-			return &children[i];
-		}
+	auto child_pos = NodeByteSearch::FindEqual(key, count, byte);
+	if (child_pos < count) {
+		D_ASSERT(children[child_pos].HasMetadata());
+		return &children[child_pos];
 	}
 	return nullptr;
 }
 
 optional_ptr<Node> Node16::GetChildMutable(const uint8_t byte) {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] == byte) {
-			D_ASSERT(children[i].HasMetadata());
-			return &children[i];
-		}
+	auto child_pos = NodeByteSearch::FindEqual(key, count, byte);
+	if (child_pos < count) {
+		D_ASSERT(children[child_pos].HasMetadata());
+		return &children[child_pos];
 	}
 	return nullptr;
 }
 
 optional_ptr<const Node> Node16::GetNextChild(uint8_t &byte) const {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] >= byte) {
-			byte = key[i];
-			D_ASSERT(children[i].HasMetadata());
-			return &children[i];
-		}
+	// the key bytes are sorted, i.e. the first byte that is greater or equal is the next child
+	auto child_pos = NodeByteSearch::FindGreaterOrEqual(key, count, byte);
+	if (child_pos < count) {
+		byte = key[child_pos];
+		D_ASSERT(children[child_pos].HasMetadata());
+		return &children[child_pos];
 	}
 	return nullptr;
 }
 
 optional_ptr<Node> Node16::GetNextChildMutable(uint8_t &byte) {
-	for (idx_t i = 0; i < count; i++) {
-		if (key[i] >= byte) {
-			byte = key[i];
-			D_ASSERT(children[i].HasMetadata());
-			return &children[i];
-		}
+	auto child_pos = NodeByteSearch::FindGreaterOrEqual(key, count, byte);
+	if (child_pos < count) {
+		byte = key[child_pos];
+		D_ASSERT(children[child_pos].HasMetadata());
+		return &children[child_pos];
 	}
 	return nullptr;
 }
@@ -1,6 +1,7 @@
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/node16.hpp"
 #include "duckdb/execution/index/art/node256.hpp"
+#include "duckdb/execution/index/art/node_byte_search.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 
 namespace duckdb {
@@ -165,23 +166,21 @@ optional_ptr<Node> Node48::GetChildMutable(const uint8_t byte) {
 }
 
 optional_ptr<const Node> Node48::GetNextChild(uint8_t &byte) const {
-	for (idx_t i = byte; i < Node::NODE_256_CAPACITY; i++) {
-		if (child_index[i] != Node::EMPTY_MARKER) {
-			byte = UnsafeNumericCast<uint8_t>(i);
-			D_ASSERT(children[child_index[i]].HasMetadata());
-			return &children[child_index[i]];
-		}
+	auto i = NodeByteSearch::FindNotEqual(child_index, byte, Node::NODE_256_CAPACITY, Node::EMPTY_MARKER);
+	if (i < Node::NODE_256_CAPACITY) {
+		byte = UnsafeNumericCast<uint8_t>(i);
+		D_ASSERT(children[child_index[i]].HasMetadata());
+		return &children[child_index[i]];
 	}
 	return nullptr;
 }
 
 optional_ptr<Node> Node48::GetNextChildMutable(uint8_t &byte) {
-	for (idx_t i = byte; i < Node::NODE_256_CAPACITY; i++) {
-		if (child_index[i] != Node::EMPTY_MARKER) {
-			byte = UnsafeNumericCast<uint8_t>(i);
-			D_ASSERT(children[child_index[i]].HasMetadata());
-			return &children[child_index[i]];
-		}
+	auto i = NodeByteSearch::FindNotEqual(child_index, byte, Node::NODE_256_CAPACITY, Node::EMPTY_MARKER);
+	if (i < Node::NODE_256_CAPACITY) {
+		byte = UnsafeNumericCast<uint8_t>(i);
+		D_ASSERT(children[child_index[i]].HasMetadata());
+		return &children[child_index[i]];
 	}
 	return nullptr;
 }
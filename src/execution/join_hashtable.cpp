@@ -1,7 +1,9 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/ht_entry.hpp"
@@ -166,10 +168,12 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	idx_t non_empty_count = 0;
 
 	// first, filter out the empty rows and calculate the offset
+	// the entries of the whole vector are prefetched, so that their cache misses overlap with each other
 	for (idx_t i = 0; i < count; i++) {
 		const auto row_index = sel.get_index(i);
 		auto uvf_index = hashes_v_unified.sel->get_index(row_index);
 		auto ht_offset = hashes[uvf_index] & ht->bitmask;
+		PrefetchForRead(entries + ht_offset);
 		ht_offsets_dense[i] = ht_offset;
 		ht_offsets[row_index] = ht_offset;
 	}
@@ -250,6 +254,10 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
 			// will not be compared anyway as with an empty entry we are already done
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+			if (occupied) {
+				// prefetch the row, the keys are compared after the entries of all rows have been found
+				PrefetchForRead(row_ptr_insert_to[row_index]);
+			}
 		}
 
 		if (salt_match_count != 0) {
@@ -708,6 +716,10 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			// insert the hashes before InsertHashes overwrites them with offsets and salts
+			bloom_filter->Insert(hash_data, count);
+		}
 		TupleDataChunkState &chunk_state = iterator.GetChunkState();
 
 		InsertHashes(hashes, count, chunk_state, insert_state, parallel);
@@ -864,6 +876,12 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
+	// prefetch the next rows of the chains before their predicates are resolved and their columns are gathered
+	for (idx_t i = 0; i < new_count; i++) {
+		auto ptr = ptrs[this->sel_vector.get_index(i)];
+		PrefetchForRead(ptr);
+		PrefetchForRead(ptr + ht.pointer_offset);
+	}
 	this->count = new_count;
 }
 
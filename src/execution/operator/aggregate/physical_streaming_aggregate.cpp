@@ -0,0 +1,305 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	D_ASSERT(CanStream(aggregates));
+	vector<BoundAggregateExpression *> bindings;
+	for (auto &expr : aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		bindings.push_back(&aggr);
+		// The children of an aggregate are consecutive references to the input (see ExtractAggregateExpressions)
+		payload_indexes.push_back(aggr.children.empty() ? 0
+		                                                : aggr.children[0]->Cast<BoundReferenceExpression>().index);
+	}
+	layout.Initialize(AggregateObject::CreateAggregateObjects(bindings));
+}
+
+bool PhysicalStreamingAggregate::CanStream(const vector<unique_ptr<Expression>> &aggregates) {
+	for (auto &expr : aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct() || aggr.order_bys || !aggr.function.combine) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// State
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ClientContext &context, const PhysicalStreamingAggregate &op)
+	    : layout(op.layout.Copy()), chunk_allocator(BufferAllocator::Get(context)),
+	      group_allocator(BufferAllocator::Get(context)), has_group(false), addresses(LogicalType::POINTER),
+	      state_addresses(LogicalType::POINTER), finalize_addresses(LogicalType::POINTER),
+	      shifted_sel(STANDARD_VECTOR_SIZE), distinct_sel(STANDARD_VECTOR_SIZE), group_starts(STANDARD_VECTOR_SIZE) {
+		const auto row_width = layout.GetRowWidth();
+		chunk_states = make_unsafe_uniq_array_uninitialized<data_t>(STANDARD_VECTOR_SIZE * row_width);
+		group_state = make_unsafe_uniq_array_uninitialized<data_t>(row_width);
+		new_group = make_unsafe_uniq_array_uninitialized<bool>(STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+			shifted_sel.set_index(i, i + 1);
+		}
+		filter_set.Initialize(context, layout.GetAggregates(), op.children[0]->GetTypes());
+	}
+
+	~StreamingAggregateState() override {
+		if (has_group) {
+			auto state_ptr = group_state.get();
+			DestroyStates(group_allocator, &state_ptr, 1);
+		}
+	}
+
+	//! Whether the first row of the input belongs to the open group
+	bool ContinuesGroup(DataChunk &input, const vector<unique_ptr<Expression>> &groups) const {
+		if (!has_group) {
+			return false;
+		}
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto &ref = groups[group_idx]->Cast<BoundReferenceExpression>();
+			if (!Value::NotDistinctFrom(input.GetValue(ref.index, 0), group_values[group_idx])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//! Combines the given states into the states of the open group, copying any data into the group allocator
+	void CombineIntoGroup(data_ptr_t source) {
+		auto offset = layout.GetAggrOffset();
+		for (auto &aggr : layout.GetAggregates()) {
+			Vector source_state(Value::POINTER(CastPointerToValue(source + offset)));
+			Vector target_state(Value::POINTER(CastPointerToValue(group_state.get() + offset)));
+			AggregateInputData aggr_input_data(aggr.GetFunctionData(), group_allocator,
+			                                   AggregateCombineType::PRESERVE_INPUT);
+			aggr.function.combine(source_state, target_state, aggr_input_data, 1);
+			offset += aggr.payload_size;
+		}
+	}
+
+	void DestroyStates(ArenaAllocator &allocator, data_ptr_t *states, idx_t count) {
+		if (!layout.HasDestructor()) {
+			return;
+		}
+		Vector state_vector(LogicalType::POINTER);
+		auto state_data = FlatVector::GetData<data_ptr_t>(state_vector);
+		for (idx_t i = 0; i < count; i++) {
+			state_data[i] = states[i];
+		}
+		RowOperationsState row_state(allocator);
+		RowOperations::DestroyStates(row_state, layout, state_vector, count);
+	}
+
+public:
+	TupleDataLayout layout;
+	//! Allocator for the aggregates of the groups in the current input chunk, reset after every chunk
+	ArenaAllocator chunk_allocator;
+	//! Allocator for the aggregates of the open group, reset whenever the open group is emitted
+	ArenaAllocator group_allocator;
+
+	//! Aggregate states of the groups in the current input chunk
+	unsafe_unique_array<data_t> chunk_states;
+	//! Aggregate states of the open group, i.e., the last group we have seen, which may continue in the next chunk
+	unsafe_unique_array<data_t> group_state;
+	//! Whether there is an open group, and its values
+	bool has_group;
+	vector<Value> group_values;
+
+	//! For each row of the input, whether it starts a new group
+	unsafe_unique_array<bool> new_group;
+	//! State pointers of each input row / each group in the current input chunk / each finished group
+	Vector addresses;
+	Vector state_addresses;
+	Vector finalize_addresses;
+	//! Selects row i + 1 at position i
+	SelectionVector shifted_sel;
+	SelectionVector distinct_sel;
+	//! Rows of the input that start a new group
+	SelectionVector group_starts;
+
+	AggregateFilterDataSet filter_set;
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// Find the rows that start a new group by comparing each row to the previous one
+	auto new_group = state.new_group.get();
+	new_group[0] = !state.ContinuesGroup(input, groups);
+	std::fill_n(new_group + 1, count - 1, false);
+	if (count > 1) {
+		for (auto &group : groups) {
+			auto &column = input.data[group->Cast<BoundReferenceExpression>().index];
+			Vector next(column, state.shifted_sel, count - 1);
+			const auto distinct_count =
+			    VectorOperations::DistinctFrom(next, column, nullptr, count - 1, &state.distinct_sel, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				new_group[state.distinct_sel.get_index(i) + 1] = true;
+			}
+		}
+	}
+
+	// Every group in this chunk gets fresh states, including the first one if it continues the open group
+	const auto row_width = layout.GetRowWidth();
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	auto states = FlatVector::GetData<data_ptr_t>(state.state_addresses);
+	idx_t state_count = 0;
+	idx_t group_start_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (new_group[i]) {
+			state.group_starts.set_index(group_start_count++, i);
+		}
+		if (i == 0 || new_group[i]) {
+			states[state_count] = state.chunk_states.get() + state_count * row_width;
+			state_count++;
+		}
+		addresses[i] = states[state_count - 1];
+	}
+	auto &state_layout = state.layout;
+	RowOperations::InitializeStates(state_layout, state.state_addresses, *FlatVector::IncrementalSelectionVector(),
+	                                state_count);
+
+	// Update the aggregates
+	RowOperationsState row_state(state.chunk_allocator);
+	auto &aggregate_objects = state_layout.GetAggregates();
+	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(state_layout.GetAggrOffset()), count);
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_objects.size(); aggr_idx++) {
+		auto &aggr = aggregate_objects[aggr_idx];
+		if (aggr.filter) {
+			RowOperations::UpdateFilteredStates(row_state, state.filter_set.GetFilterData(aggr_idx), aggr,
+			                                    state.addresses, input, payload_indexes[aggr_idx]);
+		} else {
+			RowOperations::UpdateStates(row_state, aggr, state.addresses, input, payload_indexes[aggr_idx], count);
+		}
+		VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(aggr.payload_size), count);
+	}
+
+	const auto continues_group = !new_group[0];
+	if (continues_group) {
+		state.CombineIntoGroup(states[0]);
+	}
+
+	if (group_start_count != 0) {
+		// The open group is finished, as are all groups that start in this chunk except for the last one
+		auto finalize_states = FlatVector::GetData<data_ptr_t>(state.finalize_addresses);
+		idx_t finished_count = 0;
+		if (state.has_group) {
+			for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+				chunk.data[group_idx].SetValue(0, state.group_values[group_idx]);
+			}
+			finalize_states[finished_count++] = state.group_state.get();
+		}
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto &column = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+			VectorOperations::Copy(column, chunk.data[group_idx], state.group_starts, group_start_count - 1, 0,
+			                       finished_count);
+		}
+		for (idx_t state_idx = continues_group ? 1 : 0; state_idx + 1 < state_count; state_idx++) {
+			finalize_states[finished_count++] = states[state_idx];
+		}
+		chunk.SetCardinality(finished_count);
+		RowOperations::FinalizeStates(row_state, state_layout, state.finalize_addresses, chunk, groups.size());
+
+		if (state.has_group) {
+			auto group_state = state.group_state.get();
+			state.DestroyStates(state.group_allocator, &group_state, 1);
+			state.group_allocator.Reset();
+		}
+
+		// The last group that starts in this chunk becomes the open group
+		Vector group_state(Value::POINTER(CastPointerToValue(state.group_state.get())));
+		group_state.Flatten(1);
+		RowOperations::InitializeStates(state_layout, group_state, *FlatVector::IncrementalSelectionVector(), 1);
+		state.CombineIntoGroup(states[state_count - 1]);
+
+		const auto last_start = state.group_starts.get_index(group_start_count - 1);
+		state.group_values.clear();
+		for (auto &group : groups) {
+			state.group_values.push_back(input.GetValue(group->Cast<BoundReferenceExpression>().index, last_start));
+		}
+		state.has_group = true;
+	}
+
+	state.DestroyStates(state.chunk_allocator, states, state_count);
+	state.chunk_allocator.Reset();
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_group) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+
+	// Emit the open group
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		chunk.data[group_idx].SetValue(0, state.group_values[group_idx]);
+	}
+	chunk.SetCardinality(1);
+	auto group_state = state.group_state.get();
+	FlatVector::GetData<data_ptr_t>(state.finalize_addresses)[0] = group_state;
+	RowOperationsState row_state(state.group_allocator);
+	RowOperations::FinalizeStates(row_state, state.layout, state.finalize_addresses, chunk, groups.size());
+
+	state.DestroyStates(state.group_allocator, &group_state, 1);
+	state.group_allocator.Reset();
+	state.has_group = false;
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+InsertionOrderPreservingMap<string> PhysicalStreamingAggregate::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	string groups_info;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			groups_info += "\n";
+		}
+		groups_info += groups[i]->GetName();
+	}
+	result["Groups"] = groups_info;
+
+	string aggregate_info;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0) {
+			aggregate_info += "\n";
+		}
+		aggregate_info += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			aggregate_info += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	result["Aggregates"] = aggregate_info;
+	return result;
+}
+
+} // namespace duckdb
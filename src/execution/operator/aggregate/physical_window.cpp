@@ -246,6 +246,20 @@ static unique_ptr<WindowExecutor> WindowExecutorFactory(BoundWindowExpression &w
 	}
 }
 
+static bool FramesAreEqual(const BoundWindowExpression &lhs, const BoundWindowExpression &rhs) {
+	//	Only aggregates, because the other functions can have extra bounds state (e.g., peers for RANK)
+	if (lhs.type != ExpressionType::WINDOW_AGGREGATE || rhs.type != ExpressionType::WINDOW_AGGREGATE) {
+		return false;
+	}
+	if (lhs.start != rhs.start || lhs.end != rhs.end || lhs.exclude_clause != rhs.exclude_clause) {
+		return false;
+	}
+	if (!Expression::Equals(lhs.start_expr, rhs.start_expr) || !Expression::Equals(lhs.end_expr, rhs.end_expr)) {
+		return false;
+	}
+	return lhs.KeysAreCompatible(rhs);
+}
+
 WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientContext &context)
     : op(op), context(context) {
 
@@ -257,6 +271,14 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
 		auto wexec = WindowExecutorFactory(wexpr, context, mode);
+		//	Functions with the same frame (e.g., many rolling aggregates) only compute the frame bounds once
+		for (idx_t prev_idx = 0; prev_idx < executors.size(); ++prev_idx) {
+			auto &prev = *executors[prev_idx];
+			if (prev.frame_source == DConstants::INVALID_INDEX && FramesAreEqual(prev.wexpr, wexpr)) {
+				wexec->frame_source = prev_idx;
+				break;
+			}
+		}
 		executors.emplace_back(std::move(wexec));
 	}
 
@@ -794,7 +816,11 @@ void WindowLocalSourceState::GetData(DataChunk &result) {
 		auto &gstate = *gestates[expr_idx];
 		auto &lstate = *local_states[expr_idx];
 		auto &result = output_chunk.data[expr_idx];
-		executor.Evaluate(position, input_chunk, result, lstate, gstate);
+		optional_ptr<WindowExecutorLocalState> bounds_source;
+		if (executor.frame_source != DConstants::INVALID_INDEX) {
+			bounds_source = local_states[executor.frame_source].get();
+		}
+		executor.Evaluate(position, input_chunk, result, lstate, gstate, bounds_source);
 	}
 	output_chunk.SetCardinality(input_chunk);
 	output_chunk.Verify();
@@ -217,6 +217,7 @@ void CSVStateMachineCache::Insert(const CSVStateMachineOptions &state_machine_op
 	transition_array.carriage_return = static_cast<uint8_t>('\r');
 	transition_array.quote = quote;
 	transition_array.escape = escape;
+	transition_array.comment = comment;
 
 	// Shift and OR to replicate across all bytes
 	ShiftAndReplicateBits(transition_array.delimiter);
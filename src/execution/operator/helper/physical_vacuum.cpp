@@ -1,8 +1,10 @@
 #include "duckdb/execution/operator/helper/physical_vacuum.hpp"
 
+#include "duckdb/execution/reservoir_sample.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
 namespace duckdb {
@@ -15,39 +17,64 @@ PhysicalVacuum::PhysicalVacuum(unique_ptr<VacuumInfo> info_p, optional_ptr<Table
 
 class VacuumLocalSinkState : public LocalSinkState {
 public:
-	explicit VacuumLocalSinkState(VacuumInfo &info, optional_ptr<TableCatalogEntry> table) {
-		for (const auto &column_name : info.columns) {
-			auto &column = table->GetColumn(column_name);
+	explicit VacuumLocalSinkState(ClientContext &context, VacuumInfo &info, optional_ptr<TableCatalogEntry> table)
+	    : rows_seen(0) {
+		vector<LogicalType> sample_types;
+		for (idx_t col_idx = 0; col_idx < info.columns.size(); col_idx++) {
+			auto &column = table->GetColumn(info.columns[col_idx]);
 			if (DistinctStatistics::TypeIsSupported(column.GetType())) {
 				column_distinct_stats.push_back(make_uniq<DistinctStatistics>());
 			} else {
 				column_distinct_stats.push_back(nullptr);
 			}
+			if (HistogramStatistics::TypeIsSupported(column.GetType())) {
+				histogram_columns.push_back(col_idx);
+				sample_types.push_back(column.GetType());
+			}
+		}
+		if (!histogram_columns.empty()) {
+			sample = make_uniq<ReservoirSample>(Allocator::Get(context), HistogramStatistics::SAMPLE_SIZE);
+			sample_chunk.InitializeEmpty(sample_types);
 		}
 	};
 
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+	//! The columns for which a histogram is built
+	vector<idx_t> histogram_columns;
+	//! The sample of the histogram columns
+	unique_ptr<ReservoirSample> sample;
+	//! The chunk referencing the histogram columns of the input
+	DataChunk sample_chunk;
+	//! The number of rows from which the sample was taken
+	idx_t rows_seen;
 };
 
 unique_ptr<LocalSinkState> PhysicalVacuum::GetLocalSinkState(ExecutionContext &context) const {
-	return make_uniq<VacuumLocalSinkState>(*info, table);
+	return make_uniq<VacuumLocalSinkState>(context.client, *info, table);
 }
 
 class VacuumGlobalSinkState : public GlobalSinkState {
 public:
 	explicit VacuumGlobalSinkState(VacuumInfo &info, optional_ptr<TableCatalogEntry> table) {
-		for (const auto &column_name : info.columns) {
-			auto &column = table->GetColumn(column_name);
+		for (idx_t col_idx = 0; col_idx < info.columns.size(); col_idx++) {
+			auto &column = table->GetColumn(info.columns[col_idx]);
 			if (DistinctStatistics::TypeIsSupported(column.GetType())) {
 				column_distinct_stats.push_back(make_uniq<DistinctStatistics>());
 			} else {
 				column_distinct_stats.push_back(nullptr);
 			}
+			if (HistogramStatistics::TypeIsSupported(column.GetType())) {
+				histogram_columns.push_back(col_idx);
+			}
 		}
 	};
 
 	mutex stats_lock;
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+	//! The columns for which a histogram is built
+	vector<idx_t> histogram_columns;
+	//! The samples of the individual threads, and the number of rows they were taken from
+	vector<pair<unique_ptr<ReservoirSample>, idx_t>> samples;
 };
 
 unique_ptr<GlobalSinkState> PhysicalVacuum::GetGlobalSinkState(ClientContext &context) const {
@@ -64,6 +91,15 @@ SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, DataChunk &chunk,
 		}
 		lstate.column_distinct_stats[col_idx]->Update(chunk.data[col_idx], chunk.size(), false);
 	}
+	if (lstate.sample) {
+		lstate.sample_chunk.Reset();
+		for (idx_t i = 0; i < lstate.histogram_columns.size(); i++) {
+			lstate.sample_chunk.data[i].Reference(chunk.data[lstate.histogram_columns[i]]);
+		}
+		lstate.sample_chunk.SetCardinality(chunk.size());
+		lstate.sample->AddToReservoir(lstate.sample_chunk);
+		lstate.rows_seen += chunk.size();
+	}
 
 	return SinkResultType::NEED_MORE_INPUT;
 }
@@ -81,6 +117,9 @@ SinkCombineResultType PhysicalVacuum::Combine(ExecutionContext &context, Operato
 			g_state.column_distinct_stats[col_idx]->Merge(*l_state.column_distinct_stats[col_idx]);
 		}
 	}
+	if (l_state.sample) {
+		g_state.samples.emplace_back(std::move(l_state.sample), l_state.rows_seen);
+	}
 
 	return SinkCombineResultType::FINISHED;
 }
@@ -94,6 +133,39 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 		tbl->GetStorage().SetDistinct(column_id_map.at(col_idx), std::move(sink.column_distinct_stats[col_idx]));
 	}
 
+	// build the histograms from the samples - every sampled row represents (rows seen / sample size) rows
+	vector<vector<Value>> values(sink.histogram_columns.size());
+	vector<vector<double>> weights(sink.histogram_columns.size());
+	double total_weight = 0;
+	for (auto &entry : sink.samples) {
+		auto &sample = *entry.first;
+		auto rows_seen = entry.second;
+		auto weight = rows_seen > sample.sample_count ? double(rows_seen) / double(sample.sample_count) : 1.0;
+		while (true) {
+			auto chunk = sample.GetChunk();
+			if (!chunk) {
+				break;
+			}
+			for (idx_t row_idx = 0; row_idx < chunk->size(); row_idx++) {
+				for (idx_t i = 0; i < sink.histogram_columns.size(); i++) {
+					auto value = chunk->GetValue(i, row_idx);
+					if (value.IsNull()) {
+						continue;
+					}
+					values[i].push_back(std::move(value));
+					weights[i].push_back(weight);
+				}
+				total_weight += weight;
+			}
+		}
+	}
+	for (idx_t i = 0; i < sink.histogram_columns.size(); i++) {
+		auto col_idx = sink.histogram_columns[i];
+		auto type = tbl->GetColumn(info->columns[col_idx]).GetType();
+		auto histogram = HistogramStatistics::Build(type, values[i], weights[i], total_weight);
+		tbl->GetStorage().SetHistogram(column_id_map.at(col_idx), std::move(histogram));
+	}
+
 	return SinkFinalizeType::READY;
 }
 
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
@@ -14,6 +15,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -449,6 +451,11 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		if (sink.hash_table->bloom_filter) {
+			// the Bloom filter has been filled in by the finalize tasks - we can now push it into the probe side
+			sink.hash_table->bloom_filter.reset();
+			sink.op.filter_pushdown->PushBloomFilter(*sink.global_filter_state, sink.op);
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -563,7 +570,20 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+static bool KeysCoverRange(const Value &min_val, const Value &max_val, idx_t build_count) {
+	auto physical_type = min_val.type().InternalType();
+	if (!min_val.type().IsIntegral() || physical_type == PhysicalType::INT128 ||
+	    physical_type == PhysicalType::UINT128) {
+		return false;
+	}
+	auto min = HugeIntValue::Get(min_val.DefaultCastAs(LogicalType::HUGEINT));
+	auto max = HugeIntValue::Get(max_val.DefaultCastAs(LogicalType::HUGEINT));
+	// if the build-side keys cover more than half of [min, max], the range filter already does most of the work
+	return max - min < hugeint_t(NumericCast<int64_t>(build_count)) * hugeint_t(2);
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op,
+                                         JoinHashTable &ht) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -594,6 +614,14 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
 		} else {
+			// we can build a Bloom filter from the hashes in the hash table if they are the hashes of this column only
+			if (filter.join_condition == 0 && ht.equality_types.size() == 1 &&
+			    ht.Count() <= BlockedBloomFilter::MAXIMUM_BLOCK_COUNT * 64 / BlockedBloomFilter::BITS_PER_KEY &&
+			    !KeysCoverRange(min_val, max_val, ht.Count())) {
+				gstate.bloom_filter = make_shared_ptr<BlockedBloomFilter>(ht.Count());
+				gstate.bloom_filter_idx = filter_idx;
+				ht.bloom_filter = gstate.bloom_filter;
+			}
 			// min != max - generate a range filter
 			auto greater_equals =
 			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val));
@@ -606,11 +634,30 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 	}
 }
 
+void JoinFilterPushdownInfo::PushBloomFilter(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+	if (!gstate.bloom_filter) {
+		return;
+	}
+	auto &filter = filters[gstate.bloom_filter_idx.GetIndex()];
+	auto &key_type = min_max_aggregates[gstate.bloom_filter_idx.GetIndex() * 2]->return_type;
+	auto bloom_filter = make_uniq<BloomFilter>(key_type, std::move(gstate.bloom_filter));
+	dynamic_filters->PushFilter(op, filter.probe_column_index.column_index, std::move(bloom_filter));
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (!build_table_indexes.empty()) {
+		// report the actual size of the build side, so the query can be re-optimized if it was badly misestimated
+		idx_t build_count = 0;
+		for (auto &local_ht : sink.local_hash_tables) {
+			build_count += local_ht->GetSinkCollection().Count();
+		}
+		pipeline.executor.ReportCardinality(build_table_indexes, children[1]->estimated_cardinality, build_count);
+	}
+
 	sink.temporary_memory_state->UpdateReservation(context);
 	sink.external = sink.temporary_memory_state->GetReservation() < sink.total_size;
 	if (sink.external) {
@@ -649,7 +696,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(*sink.global_filter_state, *this, ht);
 	}
 
 	// check for possible perfect hash table
@@ -663,6 +710,10 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
 		sink.ScheduleFinalize(pipeline, event);
+	} else if (ht.bloom_filter) {
+		// the pointer table is not built - so neither is the Bloom filter
+		ht.bloom_filter.reset();
+		sink.global_filter_state->bloom_filter.reset();
 	}
 	sink.finalized = true;
 	if (ht.Count() == 0 && EmptyResultIfRHSIsEmpty()) {
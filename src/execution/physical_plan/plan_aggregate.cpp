@@ -1,14 +1,18 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
 
@@ -149,11 +153,80 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static bool IsClusteredOnColumns(PhysicalOperator &plan, unordered_set<idx_t> columns) {
+	// Follow the columns through operators that do not change the order of the rows
+	reference<PhysicalOperator> current(plan);
+	while (current.get().type == PhysicalOperatorType::PROJECTION ||
+	       current.get().type == PhysicalOperatorType::FILTER) {
+		if (current.get().type == PhysicalOperatorType::PROJECTION) {
+			auto &projection = current.get().Cast<PhysicalProjection>();
+			unordered_set<idx_t> child_columns;
+			for (auto &col : columns) {
+				auto expr = projection.select_list[col].get();
+				if (expr->GetExpressionType() == ExpressionType::BOUND_FUNCTION) {
+					// (De)compressing (see CompressedMaterialization) maps equal values to equal values
+					auto &func = expr->Cast<BoundFunctionExpression>();
+					if (!StringUtil::StartsWith(func.function.name, "__internal_compress") &&
+					    !StringUtil::StartsWith(func.function.name, "__internal_decompress")) {
+						return false;
+					}
+					expr = func.children[0].get();
+				}
+				if (expr->GetExpressionType() != ExpressionType::BOUND_REF) {
+					return false;
+				}
+				child_columns.insert(expr->Cast<BoundReferenceExpression>().index);
+			}
+			columns = std::move(child_columns);
+		}
+		current = *current.get().children[0];
+	}
+	if (current.get().type != PhysicalOperatorType::ORDER_BY) {
+		return false;
+	}
+
+	// The rows are clustered on the columns if they are the leading sort keys
+	auto &order = current.get().Cast<PhysicalOrder>();
+	unordered_set<idx_t> remaining_columns;
+	for (auto &col : columns) {
+		remaining_columns.insert(order.projections[col]);
+	}
+	for (auto &order_node : order.orders) {
+		if (remaining_columns.empty()) {
+			break;
+		}
+		if (order_node.expression->GetExpressionType() != ExpressionType::BOUND_REF ||
+		    remaining_columns.erase(order_node.expression->Cast<BoundReferenceExpression>().index) == 0) {
+			return false;
+		}
+	}
+	return remaining_columns.empty();
+}
+
+static bool CanUseStreamingAggregate(LogicalAggregate &op, PhysicalOperator &plan) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (!PhysicalStreamingAggregate::CanStream(op.expressions)) {
+		return false;
+	}
+	unordered_set<idx_t> group_columns;
+	for (auto &group : op.groups) {
+		if (group->GetExpressionType() != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		group_columns.insert(group->Cast<BoundReferenceExpression>().index);
+	}
+	return IsClusteredOnColumns(plan, std::move(group_columns));
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
 	auto plan = CreatePlan(*op.children[0]);
+	// if the input is sorted on the groups we can emit each group as soon as it is complete
+	const auto use_streaming_aggregate = CanUseStreamingAggregate(op, *plan);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
 
@@ -180,7 +253,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		// groups! create a GROUP BY aggregator
 		// use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (use_streaming_aggregate) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -8,6 +8,7 @@
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/operator/subtract.hpp"
@@ -198,10 +199,14 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan =
+		auto hash_join =
 		    make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions), op.join_type,
 		                                op.left_projection_map, op.right_projection_map, std::move(op.mark_types),
 		                                op.estimated_cardinality, perfect_join_stats, std::move(op.filter_pushdown));
+		if (client_config.adaptive_reoptimization_threshold > 0) {
+			hash_join->build_table_indexes = CardinalityFeedback::GetTableIndexes(*op.children[1]);
+		}
+		plan = std::move(hash_join);
 
 	} else {
 		if (left->estimated_cardinality <= client_config.nested_loop_join_threshold ||
@@ -4,6 +4,8 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/set/physical_union.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_set_operation.hpp"
@@ -84,8 +86,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalSetOperati
 		PerfectHashJoinStats join_stats; // used in inner joins only
 
 		JoinType join_type = op.type == LogicalOperatorType::LOGICAL_EXCEPT ? JoinType::ANTI : JoinType::SEMI;
-		result = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(conditions), join_type,
-		                                     op.estimated_cardinality, join_stats);
+		auto hash_join = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(conditions),
+		                                             join_type, op.estimated_cardinality, join_stats);
+		if (ClientConfig::GetConfig(context).adaptive_reoptimization_threshold > 0) {
+			hash_join->build_table_indexes = CardinalityFeedback::GetTableIndexes(*op.children[1]);
+		}
+		result = std::move(hash_join);
 
 		// For EXCEPT ALL / INTERSECT ALL we need to remove the row number column again
 		if (op.setop_all) {
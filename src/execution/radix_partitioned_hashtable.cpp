@@ -142,6 +142,10 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! Minimum number of rows a thread must sink before deciding whether pre-aggregation reduces its data
+	static constexpr const idx_t SKIP_LOOKUP_SINK_COUNT = 262144;
+	//! If the groups make up more than this fraction of the sunk rows, the thread stops pre-aggregating
+	static constexpr const double SKIP_LOOKUP_UNIQUE_PERCENTAGE = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -333,12 +337,16 @@ public:
 	unique_ptr<GroupedAggregateHashTable> ht;
 	//! Chunk with group columns
 	DataChunk group_chunk;
+	//! Rows sunk into / groups created in the HT so far, used to measure how much pre-aggregation reduces the data
+	idx_t sink_count;
+	idx_t group_count;
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0), group_count(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -457,6 +465,7 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
@@ -465,9 +474,18 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	if (gstate.number_of_threads > 2) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
+		lstate.group_count += ht.Count();
 		ht.ClearPointerTable();
 		ht.ResetCount();
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+
+		// If (almost) every row has created a new group so far, pre-aggregating is not reducing the data
+		// Stop probing the HT and append the rows directly, they are combined when the partitions are finalized
+		if (!ht.SkipsLookups() && lstate.sink_count >= RadixHTConfig::SKIP_LOOKUP_SINK_COUNT &&
+		    static_cast<double>(lstate.group_count) >
+		        RadixHTConfig::SKIP_LOOKUP_UNIQUE_PERCENTAGE * static_cast<double>(lstate.sink_count)) {
+			ht.SkipLookups();
+		}
 	}
 
 	// Check if we need to repartition
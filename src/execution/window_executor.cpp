@@ -869,7 +869,9 @@ WindowExecutor::WindowExecutor(BoundWindowExpression &wexpr, ClientContext &cont
 WindowExecutorGlobalState::WindowExecutorGlobalState(const WindowExecutor &executor, const idx_t payload_count,
                                                      const ValidityMask &partition_mask, const ValidityMask &order_mask)
     : executor(executor), payload_count(payload_count), partition_mask(partition_mask), order_mask(order_mask),
-      range((HasPrecedingRange(executor.wexpr) || HasFollowingRange(executor.wexpr))
+      // The RANGE values are only needed to compute the bounds, so they are not needed if the bounds are shared
+      range((HasPrecedingRange(executor.wexpr) || HasFollowingRange(executor.wexpr)) &&
+                    executor.frame_source == DConstants::INVALID_INDEX
                 ? executor.wexpr.orders[0].expression.get()
                 : nullptr,
             executor.context, payload_count) {
@@ -925,6 +927,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsSlidingAggregate();
 
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
 	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
@@ -1020,10 +1023,60 @@ bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+static bool BoundaryOnlyMovesForward(const WindowBoundary &boundary, const unique_ptr<Expression> &expr) {
+	switch (boundary) {
+	case WindowBoundary::UNBOUNDED_PRECEDING:
+	case WindowBoundary::CURRENT_ROW_ROWS:
+	case WindowBoundary::CURRENT_ROW_RANGE:
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+	case WindowBoundary::EXPR_PRECEDING_RANGE:
+	case WindowBoundary::EXPR_FOLLOWING_RANGE:
+		//	Offsets that vary from row to row can move the boundary backwards
+		return expr && expr->IsScalar();
+	default:
+		return false;
+	}
+}
+
+bool WindowAggregateExecutorGlobalState::IsSlidingAggregate() {
+	const auto &wexpr = executor.wexpr;
+	const auto &mode = reinterpret_cast<const WindowAggregateExecutor &>(executor).mode;
+
+	if (!wexpr.aggregate || wexpr.children.empty()) {
+		return false;
+	}
+
+	//	The partial aggregates are combined out of order
+	AggregateObject aggr(wexpr);
+	if (!aggr.function.combine || aggr.function.order_dependent != AggregateOrderDependent::NOT_ORDER_DEPENDENT) {
+		return false;
+	}
+
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	//	Frames that extend to the end of the partition would keep a partial aggregate for every row
+	if (!BoundaryOnlyMovesForward(wexpr.start, wexpr.start_expr) ||
+	    !BoundaryOnlyMovesForward(wexpr.end, wexpr.end_expr)) {
+		return false;
+	}
+
+	return (mode < WindowAggregationMode::COMBINE);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
-                              WindowExecutorGlobalState &gstate) const {
+                              WindowExecutorGlobalState &gstate,
+                              optional_ptr<WindowExecutorLocalState> bounds_source) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
-	lbstate.UpdateBounds(row_idx, input_chunk, gstate.range);
+	if (bounds_source) {
+		D_ASSERT(frame_source != DConstants::INVALID_INDEX);
+		lbstate.bounds.Reference(bounds_source->Cast<WindowExecutorBoundsState>().bounds);
+	} else {
+		lbstate.UpdateBounds(row_idx, input_chunk, gstate.range);
+	}
 
 	const auto count = input_chunk.size();
 	EvaluateInternal(gstate, lstate, result, count, row_idx);
@@ -1060,6 +1113,9 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
+	} else if (IsSlidingAggregate()) {
+		// evaluate frames that slide forward incrementally
+		aggregator = make_uniq<WindowSlidingAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
@@ -819,6 +819,318 @@ void WindowNaiveAggregator::Evaluate(const WindowAggregatorState &gsink, WindowA
 	lnstate.Evaluate(gnstate, bounds, result, count, row_idx);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSlidingAggregator
+//===--------------------------------------------------------------------===//
+WindowSlidingAggregator::WindowSlidingAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types,
+                                                 const LogicalType &result_type, const WindowExcludeMode exclude_mode)
+    : WindowAggregator(std::move(aggr), arg_types, result_type, exclude_mode) {
+	D_ASSERT(exclude_mode == WindowExcludeMode::NO_OTHER);
+}
+
+WindowSlidingAggregator::~WindowSlidingAggregator() {
+}
+
+//	The rows [lo, hi) of the last frame are covered by two stacks of partial aggregates that meet at split:
+//	front[j - lo] aggregates the rows [j, split) and back[k - back_base] aggregates the rows [split, k).
+//	The frame [begin, end) is then front[begin - lo] + back[end - back_base].
+//	When the frame begin passes split, the front is rebuilt from the rows [begin, hi),
+//	so every row is added to at most two partial aggregates as the frames slide.
+class WindowSlidingAggregatorState : public WindowAggregatorState {
+public:
+	explicit WindowSlidingAggregatorState(const WindowSlidingAggregator &aggregator);
+	~WindowSlidingAggregatorState() override;
+
+	void Evaluate(const WindowAggregatorGlobalState &gsink, const DataChunk &bounds, Vector &result, idx_t count);
+
+protected:
+	using States = vector<data_ptr_t>;
+
+	//! Allocate and initialise a partial aggregate
+	data_ptr_t CreateState(ArenaAllocator &stack_allocator);
+	//! Destroy the partial aggregates of a stack
+	void DestroyStates(States &stack, ArenaAllocator &stack_allocator);
+	//! Restart the stacks at the given row
+	void Reset(idx_t pos);
+	//! Move the split to hi, rebuilding the front from the rows [begin, hi)
+	void Flip(const WindowAggregatorGlobalState &gsink, idx_t begin);
+	//! Add the rows [hi, end) to the back
+	void Extend(const WindowAggregatorGlobalState &gsink, idx_t end);
+	//! Drop all but the last partial aggregate of the back, which is the only one later frames can use
+	void CompactBack();
+	//! Update each target with one row of [begin, end), skipping filtered rows
+	void UpdateRows(const WindowAggregatorGlobalState &gsink, idx_t begin, idx_t end, const data_ptr_t *targets,
+	                ArenaAllocator &stack_allocator);
+	//! Combine a partial aggregate into another one
+	void CombineState(data_ptr_t source, data_ptr_t target, ArenaAllocator &stack_allocator);
+	//! Flush the buffered combines into the result states
+	void FlushStates();
+
+	//! The aggregator
+	const WindowSlidingAggregator &aggregator;
+	//! The front stack
+	States front;
+	ArenaAllocator front_allocator;
+	//! The back stack
+	States back;
+	unique_ptr<ArenaAllocator> back_allocator;
+	//! Allocator swapped with the back allocator when the back is compacted
+	unique_ptr<ArenaAllocator> spare_allocator;
+	//! The rows covered by the stacks
+	idx_t lo;
+	idx_t split;
+	idx_t hi;
+	//! The row of the first partial aggregate in the back
+	idx_t back_base;
+	//! Data pointer that contains a vector of states, used for the results
+	vector<data_t> state;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! Buffered partial aggregates to combine into the results
+	Vector statel;
+	Vector statep;
+	//! Count of buffered combines
+	idx_t flush_count;
+	//! Single partial aggregate combines
+	Vector combine_source;
+	Vector combine_target;
+	//! Input data chunk, used for updating partial aggregates
+	DataChunk leaves;
+	//! The rows being updated
+	SelectionVector update_sel;
+	//! The partial aggregates being updated
+	Vector update_states;
+};
+
+WindowSlidingAggregatorState::WindowSlidingAggregatorState(const WindowSlidingAggregator &aggregator_p)
+    : aggregator(aggregator_p), front_allocator(Allocator::DefaultAllocator()),
+      back_allocator(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator())),
+      spare_allocator(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator())), lo(0), split(0), hi(0), back_base(0),
+      state(aggregator.state_size * STANDARD_VECTOR_SIZE), statef(LogicalType::POINTER), statel(LogicalType::POINTER),
+      statep(LogicalType::POINTER), flush_count(0), combine_source(LogicalType::POINTER),
+      combine_target(LogicalType::POINTER), update_states(LogicalType::POINTER) {
+	update_sel.Initialize();
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = state.data();
+	D_ASSERT(statef.GetVectorType() == VectorType::FLAT_VECTOR);
+	statef.SetVectorType(VectorType::CONSTANT_VECTOR);
+	statef.Flatten(STANDARD_VECTOR_SIZE);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += aggregator.state_size;
+	}
+}
+
+WindowSlidingAggregatorState::~WindowSlidingAggregatorState() {
+	DestroyStates(front, front_allocator);
+	DestroyStates(back, *back_allocator);
+}
+
+data_ptr_t WindowSlidingAggregatorState::CreateState(ArenaAllocator &stack_allocator) {
+	auto &aggr = aggregator.aggr;
+	auto state_ptr = stack_allocator.Allocate(aggregator.state_size);
+	aggr.function.initialize(aggr.function, state_ptr);
+	return state_ptr;
+}
+
+void WindowSlidingAggregatorState::DestroyStates(States &stack, ArenaAllocator &stack_allocator) {
+	//	The buffered combines may reference the partial aggregates
+	FlushStates();
+
+	auto &aggr = aggregator.aggr;
+	if (aggr.function.destructor) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), stack_allocator);
+		auto sdata = FlatVector::GetData<data_ptr_t>(update_states);
+		for (idx_t offset = 0; offset < stack.size(); offset += STANDARD_VECTOR_SIZE) {
+			const auto destroy_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, stack.size() - offset);
+			for (idx_t i = 0; i < destroy_count; ++i) {
+				sdata[i] = stack[offset + i];
+			}
+			aggr.function.destructor(update_states, aggr_input_data, destroy_count);
+		}
+	}
+	stack.clear();
+	stack_allocator.Reset();
+}
+
+void WindowSlidingAggregatorState::Reset(idx_t pos) {
+	DestroyStates(front, front_allocator);
+	DestroyStates(back, *back_allocator);
+	lo = split = hi = back_base = pos;
+	back.emplace_back(CreateState(*back_allocator));
+}
+
+void WindowSlidingAggregatorState::Flip(const WindowAggregatorGlobalState &gsink, idx_t begin) {
+	D_ASSERT(split < begin && begin < hi);
+	DestroyStates(front, front_allocator);
+	DestroyStates(back, *back_allocator);
+
+	//	Every state starts with its own row, and then adds the rows after it
+	for (idx_t j = begin; j < hi; ++j) {
+		front.emplace_back(CreateState(front_allocator));
+	}
+	UpdateRows(gsink, begin, hi, front.data(), front_allocator);
+	for (idx_t j = front.size() - 1; j > 0; --j) {
+		CombineState(front[j], front[j - 1], front_allocator);
+	}
+
+	lo = begin;
+	split = back_base = hi;
+	back.emplace_back(CreateState(*back_allocator));
+}
+
+void WindowSlidingAggregatorState::Extend(const WindowAggregatorGlobalState &gsink, idx_t end) {
+	D_ASSERT(hi < end);
+	//	Every state starts with the last row, and then adds the rows before it
+	const auto offset = back.size();
+	for (idx_t k = hi; k < end; ++k) {
+		back.emplace_back(CreateState(*back_allocator));
+	}
+	UpdateRows(gsink, hi, end, back.data() + offset, *back_allocator);
+	for (idx_t k = offset; k < back.size(); ++k) {
+		CombineState(back[k - 1], back[k], *back_allocator);
+	}
+	hi = end;
+}
+
+void WindowSlidingAggregatorState::CompactBack() {
+	if (back.size() <= 1) {
+		return;
+	}
+	auto last = CreateState(*spare_allocator);
+	CombineState(back.back(), last, *spare_allocator);
+	DestroyStates(back, *back_allocator);
+	std::swap(back_allocator, spare_allocator);
+	back.emplace_back(last);
+	back_base = hi;
+}
+
+void WindowSlidingAggregatorState::UpdateRows(const WindowAggregatorGlobalState &gsink, idx_t begin, idx_t end,
+                                              const data_ptr_t *targets, ArenaAllocator &stack_allocator) {
+	auto &aggr = aggregator.aggr;
+	auto &inputs = gsink.inputs;
+	auto &filter_mask = gsink.filter_mask;
+	if (leaves.ColumnCount() == 0 && inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), stack_allocator);
+	auto sdata = FlatVector::GetData<data_ptr_t>(update_states);
+	idx_t update_count = 0;
+	for (auto row = begin; row < end; ++row) {
+		if (!filter_mask.RowIsValid(row)) {
+			continue;
+		}
+		sdata[update_count] = targets[row - begin];
+		update_sel.set_index(update_count++, row);
+		if (update_count == STANDARD_VECTOR_SIZE) {
+			leaves.Slice(inputs, update_sel, update_count);
+			aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_states,
+			                     update_count);
+			update_count = 0;
+		}
+	}
+	if (update_count) {
+		leaves.Slice(inputs, update_sel, update_count);
+		aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_states, update_count);
+	}
+}
+
+void WindowSlidingAggregatorState::CombineState(data_ptr_t source, data_ptr_t target,
+                                                ArenaAllocator &stack_allocator) {
+	auto &aggr = aggregator.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), stack_allocator);
+	FlatVector::GetData<data_ptr_t>(combine_source)[0] = source;
+	FlatVector::GetData<data_ptr_t>(combine_target)[0] = target;
+	aggr.function.combine(combine_source, combine_target, aggr_input_data, 1);
+}
+
+void WindowSlidingAggregatorState::FlushStates() {
+	if (!flush_count) {
+		return;
+	}
+
+	auto &aggr = aggregator.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.combine(statel, statep, aggr_input_data, flush_count);
+
+	flush_count = 0;
+}
+
+void WindowSlidingAggregatorState::Evaluate(const WindowAggregatorGlobalState &gsink, const DataChunk &bounds,
+                                            Vector &result, idx_t count) {
+	auto &aggr = aggregator.aggr;
+	auto begins = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto ends = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+
+	//	The back of the previous chunk is no longer referenced
+	CompactBack();
+
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	auto ldata = FlatVector::GetData<data_ptr_t>(statel);
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+	for (idx_t rid = 0; rid < count; ++rid) {
+		auto agg_state = fdata[rid];
+		aggr.function.initialize(aggr.function, agg_state);
+
+		const auto begin = begins[rid];
+		const auto end = ends[rid];
+		if (begin >= end) {
+			continue;
+		}
+
+		//	Frames that move backwards (e.g., at the start of a task) start over
+		if (back.empty() || begin < lo || end < hi) {
+			Reset(begin);
+		} else if (begin > split) {
+			if (begin < hi) {
+				Flip(gsink, begin);
+			} else {
+				Reset(begin);
+			}
+		}
+		if (end > hi) {
+			Extend(gsink, end);
+		}
+
+		//	Buffer the (at most two) combines for this frame
+		if (flush_count + 2 > STANDARD_VECTOR_SIZE) {
+			FlushStates();
+		}
+		if (begin < split) {
+			ldata[flush_count] = front[begin - lo];
+			pdata[flush_count++] = agg_state;
+		}
+		ldata[flush_count] = back[end - back_base];
+		pdata[flush_count++] = agg_state;
+	}
+
+	//	Flush the final states
+	FlushStates();
+
+	//	Finalise the result aggregates and write to the result
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+
+	//	Destruct the result aggregates
+	if (aggr.function.destructor) {
+		aggr.function.destructor(statef, aggr_input_data, count);
+	}
+}
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetLocalState(const WindowAggregatorState &gstate) const {
+	return make_uniq<WindowSlidingAggregatorState>(*this);
+}
+
+void WindowSlidingAggregator::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                       const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
+	const auto &gastate = gsink.Cast<WindowAggregatorGlobalState>();
+	auto &lsstate = lstate.Cast<WindowSlidingAggregatorState>();
+	lsstate.Evaluate(gastate, bounds, result, count);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,93 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBMemoryReservationsData : public GlobalTableFunctionState {
+	DuckDBMemoryReservationsData() : offset(0) {
+	}
+
+	vector<TemporaryMemoryQuery> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBMemoryReservationsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                             vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("status");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("operator_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reservation_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("remaining_size_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("estimated_memory_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_limit_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("wait_time");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBMemoryReservationsInit(ClientContext &context,
+                                                                  TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBMemoryReservationsData>();
+
+	result->entries = TemporaryMemoryManager::Get(context).GetQueries();
+	return std::move(result);
+}
+
+void DuckDBMemoryReservationsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBMemoryReservationsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// query, VARCHAR
+		output.SetValue(col++, count, Value(entry.query));
+		// status, VARCHAR
+		output.SetValue(col++, count, Value(entry.waiting ? "waiting" : "running"));
+		// operator_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.state_count)));
+		// reservation_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.reservation)));
+		// remaining_size_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.remaining_size)));
+		// estimated_memory_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.estimated_memory)));
+		// memory_limit_bytes, BIGINT
+		output.SetValue(col++, count,
+		                entry.memory_limit == DConstants::INVALID_INDEX
+		                    ? Value(LogicalType::BIGINT)
+		                    : Value::BIGINT(NumericCast<int64_t>(entry.memory_limit)));
+		// wait_time, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(entry.wait_time));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBMemoryReservationsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_memory_reservations", {}, DuckDBMemoryReservationsFunction,
+	                              DuckDBMemoryReservationsBind, DuckDBMemoryReservationsInit));
+}
+
+} // namespace duckdb
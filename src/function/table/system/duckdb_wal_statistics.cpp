@@ -0,0 +1,139 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
+
+namespace duckdb {
+
+struct WALStatisticsEntry {
+	string database_name;
+	WALSyncStatistics sync_statistics;
+	WALReplayStatistics replay_statistics;
+};
+
+struct DuckDBWALStatisticsData : public GlobalTableFunctionState {
+	DuckDBWALStatisticsData() : offset(0) {
+	}
+
+	vector<WALStatisticsEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBWALStatisticsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("sync_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("commit_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("avg_commits_per_sync");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("max_commits_per_sync");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("avg_commit_latency");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("max_commit_latency");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("replay_wal_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replayed_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replayed_transactions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replay_time");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBWALStatisticsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBWALStatisticsData>();
+
+	auto databases = DatabaseManager::Get(context).GetDatabases(context);
+	for (auto &db_ref : databases) {
+		auto &db = db_ref.get();
+		if (db.IsSystem() || db.IsTemporary() || !db.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		auto &storage = db.GetStorageManager();
+		if (storage.InMemory()) {
+			continue;
+		}
+		WALStatisticsEntry entry;
+		entry.database_name = db.GetName();
+		auto wal = storage.GetWAL();
+		if (wal) {
+			// read-only databases do not write to the WAL
+			entry.sync_statistics = wal->GetSyncStatistics();
+		}
+		entry.replay_statistics = storage.GetReplayStatistics();
+		result->entries.push_back(std::move(entry));
+	}
+	return std::move(result);
+}
+
+void DuckDBWALStatisticsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBWALStatisticsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto &stats = entry.sync_statistics;
+		// return values:
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, entry.database_name);
+		// sync_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.sync_count)));
+		// commit_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.commit_count)));
+		// avg_commits_per_sync, DOUBLE
+		output.SetValue(col++, count,
+		                stats.sync_count == 0 ? Value()
+		                                      : Value::DOUBLE(double(stats.commit_count) / double(stats.sync_count)));
+		// max_commits_per_sync, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.max_batch_size)));
+		// avg_commit_latency, DOUBLE
+		output.SetValue(col++, count,
+		                stats.commit_count == 0 ? Value()
+		                                        : Value::DOUBLE(stats.total_commit_wait / double(stats.commit_count)));
+		// max_commit_latency, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(stats.max_commit_wait));
+		auto &replay = entry.replay_statistics;
+		// replay_wal_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(replay.wal_size)));
+		// replayed_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(replay.replayed_bytes)));
+		// replayed_transactions, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(replay.replayed_transactions)));
+		// replay_time, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(replay.replay_time));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBWALStatisticsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_wal_statistics", {}, DuckDBWALStatisticsFunction, DuckDBWALStatisticsBind,
+	                              DuckDBWALStatisticsInit));
+}
+
+} // namespace duckdb
@@ -78,6 +78,8 @@ public:
 
 	//! Returns a list of the constraints of the table
 	DUCKDB_API const vector<unique_ptr<Constraint>> &GetConstraints() const;
+	//! Returns the names of the columns on which the table is kept sorted (if any)
+	DUCKDB_API const vector<string> &GetSortKeys() const;
 	DUCKDB_API string ToSQL() const override;
 
 	//! Get statistics of a column (physical or virtual) within the table
@@ -97,6 +99,7 @@ public:
 	}
 
 	DUCKDB_API static string ColumnsToSQL(const ColumnList &columns, const vector<unique_ptr<Constraint>> &constraints);
+	DUCKDB_API static string SortKeysToSQL(const vector<string> &sort_keys);
 
 	//! Returns a list of segment information for this table, if exists
 	virtual vector<ColumnSegmentInfo> GetColumnSegmentInfo();
@@ -112,5 +115,7 @@ protected:
 	ColumnList columns;
 	//! A list of constraints that are part of this table
 	vector<unique_ptr<Constraint>> constraints;
+	//! The columns on which the rows of the table are kept sorted when it is checkpointed
+	vector<string> sort_keys;
 };
 } // namespace duckdb
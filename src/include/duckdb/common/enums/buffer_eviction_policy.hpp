@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class BufferEvictionPolicy : uint8_t {
+	//! Evict the least recently used blocks first
+	LRU = 0,
+	//! Keep blocks that are re-used while they are in memory in a separate queue, and evict blocks that were only used
+	//! once (e.g., by a sequential scan) before them
+	TWO_QUEUE = 1
+};
+
+} // namespace duckdb
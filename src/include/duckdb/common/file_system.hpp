@@ -51,6 +51,20 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A single read of a batch of reads (see FileSystem::ReadBatch)
+struct FileReadRequest {
+	FileReadRequest(void *buffer, idx_t nr_bytes, idx_t location)
+	    : buffer(buffer), nr_bytes(nr_bytes), location(location) {
+	}
+
+	//! The buffer to read into
+	void *buffer;
+	//! The number of bytes to read
+	idx_t nr_bytes;
+	//! The location in the file to read from
+	idx_t location;
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path);
@@ -60,6 +74,7 @@ public:
 	DUCKDB_API int64_t Read(void *buffer, idx_t nr_bytes);
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
+	DUCKDB_API void ReadBatch(vector<FileReadRequest> &requests);
 	DUCKDB_API void Write(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
@@ -115,6 +130,10 @@ public:
 	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Read().
 	DUCKDB_API virtual void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Read a batch of byte ranges from the file, failing if any of them could not be read completely. File systems
+	//! can have all reads of the batch in flight at the same time - the default implementation performs the reads
+	//! one after the other.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests);
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
@@ -0,0 +1,24 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+namespace duckdb {
+
+//! Hints the CPU to load the cache line containing ptr, so that a subsequent read does not stall on a cache miss.
+//! This is a no-op on compilers that do not support prefetching.
+template <class T>
+inline void PrefetchForRead(const T *ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(ptr, 0, 3);
+#else
+	(void)ptr;
+#endif
+}
+
+} // namespace duckdb
@@ -48,7 +48,8 @@ public:
 	idx_t entry_size;
 
 	RowLayout blob_layout;
-	unordered_map<idx_t, idx_t> sorting_to_blob_col;
+	//! Column index in the blob layout of each sorting column (DConstants::INVALID_INDEX if constant size)
+	vector<idx_t> sorting_to_blob_col;
 };
 
 struct GlobalSortState {
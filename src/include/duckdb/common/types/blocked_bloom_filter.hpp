@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/blocked_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+
+namespace duckdb {
+
+class Serializer;
+class Deserializer;
+class Vector;
+
+//! The BlockedBloomFilter is a register-blocked Bloom filter over 64-bit hashes.
+//! All bits for a single hash are set in (and probed from) the same 64-bit block, so a lookup is a single load.
+class BlockedBloomFilter {
+public:
+	//! Creates an empty filter sized for "expected_count" distinct hashes
+	explicit BlockedBloomFilter(idx_t expected_count);
+	//! Creates a filter from previously serialized blocks
+	BlockedBloomFilter(idx_t block_count, unsafe_unique_array<uint64_t> blocks);
+
+	//! The number of bits we reserve per inserted hash
+	static constexpr const idx_t BITS_PER_KEY = 16;
+	//! The largest number of blocks we allocate (128MB)
+	static constexpr const idx_t MAXIMUM_BLOCK_COUNT = 16777216;
+
+public:
+	//! Inserts "count" hashes into the filter - can be called concurrently from multiple threads
+	void Insert(const hash_t *hashes, idx_t count);
+	//! Probes the hashes selected by "sel", and writes the ones that may be present into "result"
+	//! Returns the number of entries in "result"
+	idx_t Lookup(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result) const;
+	//! Probes a single hash
+	bool Lookup(hash_t hash) const {
+		const auto mask = GetMask(hash);
+		return (blocks[hash & bitmask] & mask) == mask;
+	}
+
+	//! The number of hashes this filter can hold before the false positive rate degrades
+	idx_t Capacity() const {
+		return block_count * 64 / BITS_PER_KEY;
+	}
+	//! The size of the filter in bytes
+	idx_t SizeInBytes() const {
+		return block_count * sizeof(uint64_t);
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static shared_ptr<BlockedBloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! Computes the bits to set within a block from the upper bits of the hash (the lower bits select the block)
+	static inline uint64_t GetMask(hash_t hash) {
+		return (1ULL << ((hash >> 40) & 63)) | (1ULL << ((hash >> 46) & 63)) | (1ULL << ((hash >> 52) & 63)) |
+		       (1ULL << (hash >> 58));
+	}
+
+private:
+	//! The number of 64-bit blocks (always a power of two)
+	idx_t block_count;
+	//! block_count - 1, used to select a block from the lower bits of the hash
+	hash_t bitmask;
+	//! The blocks
+	unsafe_unique_array<uint64_t> blocks;
+};
+
+} // namespace duckdb
@@ -105,6 +105,16 @@ public:
 	//! Returns true if all pipelines have been completed
 	bool ExecutionIsFinished();
 
+	//! Allow the query to be re-optimized if the cardinality of a materialized intermediate result deviates from its
+	//! estimate by more than the given factor
+	void EnableReoptimization(double threshold);
+	//! Reports the cardinality of a materialized intermediate result that contains the given base tables
+	void ReportCardinality(const vector<idx_t> &table_indexes, idx_t estimated_cardinality, idx_t cardinality);
+	//! Whether or not the query should be re-optimized using the reported cardinalities
+	bool RequiresReoptimization() const {
+		return requires_reoptimization;
+	}
+
 	void RegisterTask() {
 		executor_tasks++;
 	}
@@ -176,5 +186,11 @@ private:
 
 	//! Currently alive executor tasks
 	atomic<idx_t> executor_tasks;
+
+	//! The factor by which a reported cardinality can deviate from its estimate before the query is re-optimized
+	//! (0 if the query cannot be re-optimized)
+	double reoptimization_threshold;
+	//! Whether or not a reported cardinality exceeded the threshold
+	atomic<bool> requires_reoptimization;
 };
 } // namespace duckdb
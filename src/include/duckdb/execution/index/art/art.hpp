@@ -118,6 +118,10 @@ public:
 
 	//! Find the node with a matching key, or return nullptr if not found
 	optional_ptr<const Node> Lookup(const Node &node, const ARTKey &key, idx_t depth);
+	//! Find the leaves of the first count keys, or nullptr for keys that are not found (or empty). The lookups
+	//! traverse the tree one level at a time and prefetch the next node of each key, so that the cache misses of the
+	//! different lookups overlap
+	void BatchLookup(const vector<ARTKey> &keys, const idx_t count, vector<optional_ptr<const Node>> &leaves);
 	//! Insert a key into the tree
 	bool Insert(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
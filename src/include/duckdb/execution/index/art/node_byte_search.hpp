@@ -0,0 +1,141 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/art/node_byte_search.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/constants.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DUCKDB_ART_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define DUCKDB_ART_NEON
+#include <arm_neon.h>
+#endif
+
+namespace duckdb {
+
+//! NodeByteSearch searches the (partial) key bytes of ART nodes. The searches compare 16 bytes at once, if SSE2
+//! (x86-64) or NEON (ARM) are available at compile time. Both are part of the baseline of their 64-bit instruction
+//! sets, so no runtime dispatch is required. Otherwise, the searches fall back to scalar loops.
+struct NodeByteSearch {
+	//! The number of bytes compared at once
+	static constexpr const idx_t BLOCK_SIZE = 16;
+
+	//! Returns the position of the first of the first count bytes in block that is equal to byte, or count
+	static inline idx_t FindEqual(const uint8_t *block, const uint8_t count, const uint8_t byte) {
+#if defined(DUCKDB_ART_SSE2) || defined(DUCKDB_ART_NEON)
+		return FirstMatch(CompareEqual(block, byte), count);
+#else
+		for (idx_t i = 0; i < count; i++) {
+			if (block[i] == byte) {
+				return i;
+			}
+		}
+		return count;
+#endif
+	}
+
+	//! Returns the position of the first of the first count bytes in block that is greater than or equal to byte, or
+	//! count
+	static inline idx_t FindGreaterOrEqual(const uint8_t *block, const uint8_t count, const uint8_t byte) {
+#if defined(DUCKDB_ART_SSE2) || defined(DUCKDB_ART_NEON)
+		return FirstMatch(CompareGreaterOrEqual(block, byte), count);
+#else
+		for (idx_t i = 0; i < count; i++) {
+			if (block[i] >= byte) {
+				return i;
+			}
+		}
+		return count;
+#endif
+	}
+
+	//! Returns the position of the first byte in bytes[start, end) that is not equal to byte, or end.
+	//! The bytes array must be readable in blocks of BLOCK_SIZE bytes up to the block containing end.
+	static inline idx_t FindNotEqual(const uint8_t *bytes, const idx_t start, const idx_t end, const uint8_t byte) {
+#if defined(DUCKDB_ART_SSE2) || defined(DUCKDB_ART_NEON)
+		D_ASSERT(end % BLOCK_SIZE == 0);
+		// start with the block that contains the start position, and skip the positions before it
+		auto block_start = start - start % BLOCK_SIZE;
+		auto skip = start - block_start;
+		for (; block_start < end; block_start += BLOCK_SIZE) {
+			auto mask = ~CompareEqual(bytes + block_start, byte) & BlockMask();
+			mask &= ~((uint64_t(1) << (skip * BitsPerByte())) - 1);
+			if (mask) {
+				return block_start + CountZeros<uint64_t>::Trailing(mask) / BitsPerByte();
+			}
+			skip = 0;
+		}
+		return end;
+#else
+		for (idx_t i = start; i < end; i++) {
+			if (bytes[i] != byte) {
+				return i;
+			}
+		}
+		return end;
+#endif
+	}
+
+private:
+#if defined(DUCKDB_ART_SSE2)
+	//! The number of bits per byte in the comparison masks
+	static constexpr idx_t BitsPerByte() {
+		return 1;
+	}
+	static constexpr uint64_t BlockMask() {
+		return 0xFFFF;
+	}
+	static inline uint64_t CompareEqual(const uint8_t *block, const uint8_t byte) {
+		auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+		auto result = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+		return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(result)));
+	}
+	static inline uint64_t CompareGreaterOrEqual(const uint8_t *block, const uint8_t byte) {
+		// there is no unsigned byte comparison in SSE2: keys >= byte if max(keys, byte) == keys
+		auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+		auto result = _mm_cmpeq_epi8(_mm_max_epu8(keys, _mm_set1_epi8(static_cast<char>(byte))), keys);
+		return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(result)));
+	}
+#elif defined(DUCKDB_ART_NEON)
+	//! NEON has no movemask: narrowing the comparison result yields four bits per byte
+	static constexpr idx_t BitsPerByte() {
+		return 4;
+	}
+	static constexpr uint64_t BlockMask() {
+		return ~uint64_t(0);
+	}
+	static inline uint64_t ToMask(uint8x16_t result) {
+		auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(result), 4);
+		return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+	}
+	static inline uint64_t CompareEqual(const uint8_t *block, const uint8_t byte) {
+		return ToMask(vceqq_u8(vld1q_u8(block), vdupq_n_u8(byte)));
+	}
+	static inline uint64_t CompareGreaterOrEqual(const uint8_t *block, const uint8_t byte) {
+		return ToMask(vcgeq_u8(vld1q_u8(block), vdupq_n_u8(byte)));
+	}
+#endif
+#if defined(DUCKDB_ART_SSE2) || defined(DUCKDB_ART_NEON)
+	static inline idx_t FirstMatch(uint64_t mask, const uint8_t count) {
+		D_ASSERT(count <= BLOCK_SIZE);
+		// ignore the bytes past count, they are not initialized
+		if (count < BLOCK_SIZE) {
+			mask &= (uint64_t(1) << (count * BitsPerByte())) - 1;
+		}
+		if (!mask) {
+			return count;
+		}
+		return CountZeros<uint64_t>::Trailing(mask) / BitsPerByte();
+	}
+#endif
+};
+
+} // namespace duckdb
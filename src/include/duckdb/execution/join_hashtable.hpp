@@ -23,6 +23,7 @@
 
 namespace duckdb {
 
+class BlockedBloomFilter;
 class BufferManager;
 class BufferHandle;
 class ColumnDataCollection;
@@ -257,6 +258,8 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Bloom filter over the build-side hashes that is filled in during Finalize (if any)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 
 	struct {
 		mutex mj_lock;
@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+
+//! PhysicalStreamingAggregate performs a group-by and aggregation over input that is clustered on the groups, i.e.,
+//! all rows of a group arrive consecutively. A group is emitted as soon as the groups change, so only the aggregate
+//! states of the current group are kept in memory.
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> aggregates,
+	                           vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+
+	//! The groups (references to the input columns)
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+
+	//! The layout of the aggregate states of a group
+	TupleDataLayout layout;
+	//! Index of the first input column of each aggregate
+	vector<idx_t> payload_indexes;
+
+public:
+	//! Whether the aggregate can be computed with a PhysicalStreamingAggregate (no DISTINCT or ordered aggregates, and
+	//! all aggregates can be combined without consuming their input)
+	static bool CanStream(const vector<unique_ptr<Expression>> &aggregates);
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const override;
+
+	bool RequiresFinalExecute() const override {
+		return true;
+	}
+
+	//! The groups are only complete if the input is consumed in order by a single thread
+	bool ParallelOperator() const override {
+		return false;
+	}
+
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::FIXED_ORDER;
+	}
+
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+} // namespace duckdb
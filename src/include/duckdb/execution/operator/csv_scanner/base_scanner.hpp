@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/execution/operator/csv_scanner/csv_buffer_manager.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_byte_search.hpp"
 #include "duckdb/execution/operator/csv_scanner/scanner_boundary.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_state_machine.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
@@ -142,10 +143,6 @@ protected:
 	//! Initializes the scanner
 	virtual void Initialize();
 
-	inline static bool ContainsZeroByte(uint64_t v) {
-		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
-	}
-
 	//! Process one chunk
 	template <class T>
 	void Process(T &result) {
@@ -236,15 +233,9 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				iterator.pos.buffer_pos = CSVByteSearch::SkipUntil(buffer_handle_ptr, iterator.pos.buffer_pos, to_pos,
+				                                                   state_machine->transition_array.quote,
+				                                                   state_machine->transition_array.escape);
 
 				while (state_machine->transition_array
 				           .skip_quoted[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
@@ -258,17 +249,10 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
-					                     (value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return) &
-					                     (value ^ state_machine->transition_array.comment))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				iterator.pos.buffer_pos = CSVByteSearch::SkipUntil(
+				    buffer_handle_ptr, iterator.pos.buffer_pos, to_pos, state_machine->transition_array.delimiter,
+				    state_machine->transition_array.new_line, state_machine->transition_array.carriage_return,
+				    state_machine->transition_array.comment);
 				while (state_machine->transition_array
 				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
@@ -283,15 +267,9 @@ protected:
 			case CSVState::COMMENT: {
 				T::SetComment(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				iterator.pos.buffer_pos = CSVByteSearch::SkipUntil(buffer_handle_ptr, iterator.pos.buffer_pos, to_pos,
+				                                                   state_machine->transition_array.new_line,
+				                                                   state_machine->transition_array.carriage_return);
 				while (state_machine->transition_array
 				           .skip_comment[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
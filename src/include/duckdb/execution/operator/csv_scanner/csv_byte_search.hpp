@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/csv_scanner/csv_byte_search.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/helper.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DUCKDB_CSV_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define DUCKDB_CSV_NEON
+#include <arm_neon.h>
+#endif
+
+namespace duckdb {
+
+//! CSVByteSearch skips runs of characters that do not change the state of the CSV state machine, e.g., the characters
+//! of an unquoted value. The characters to look for are passed replicated over all eight bytes of an uint64_t, as they
+//! are stored in the StateMachine. Blocks of 16 bytes are classified at once if SSE2 (x86-64) or NEON (ARM) are
+//! available at compile time, otherwise blocks of 8 bytes are classified with bit manipulation.
+struct CSVByteSearch {
+	//! Returns the position of the first byte in buffer[pos, end) that is equal to one of c0 to c3, or a position
+	//! before it from which the search must continue byte-by-byte. The returned position is always smaller than end.
+	static inline idx_t SkipUntil(const char *buffer, idx_t pos, const idx_t end, const uint64_t c0, const uint64_t c1,
+	                              const uint64_t c2, const uint64_t c3) {
+#if defined(DUCKDB_CSV_SSE2)
+		const auto v0 = _mm_set1_epi64x(static_cast<int64_t>(c0));
+		const auto v1 = _mm_set1_epi64x(static_cast<int64_t>(c1));
+		const auto v2 = _mm_set1_epi64x(static_cast<int64_t>(c2));
+		const auto v3 = _mm_set1_epi64x(static_cast<int64_t>(c3));
+		while (pos + BLOCK_SIZE < end) {
+			auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + pos));
+			auto result = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, v0), _mm_cmpeq_epi8(block, v1)),
+			                           _mm_or_si128(_mm_cmpeq_epi8(block, v2), _mm_cmpeq_epi8(block, v3)));
+			auto mask = static_cast<uint32_t>(_mm_movemask_epi8(result));
+			if (mask) {
+				return pos + CountZeros<uint32_t>::Trailing(mask);
+			}
+			pos += BLOCK_SIZE;
+		}
+		return pos;
+#elif defined(DUCKDB_CSV_NEON)
+		const auto v0 = vreinterpretq_u8_u64(vdupq_n_u64(c0));
+		const auto v1 = vreinterpretq_u8_u64(vdupq_n_u64(c1));
+		const auto v2 = vreinterpretq_u8_u64(vdupq_n_u64(c2));
+		const auto v3 = vreinterpretq_u8_u64(vdupq_n_u64(c3));
+		while (pos + BLOCK_SIZE < end) {
+			auto block = vld1q_u8(reinterpret_cast<const uint8_t *>(buffer + pos));
+			auto result = vorrq_u8(vorrq_u8(vceqq_u8(block, v0), vceqq_u8(block, v1)),
+			                       vorrq_u8(vceqq_u8(block, v2), vceqq_u8(block, v3)));
+			// NEON has no movemask: narrowing the comparison result yields four bits per byte
+			auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(result), 4);
+			auto mask = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+			if (mask) {
+				return pos + CountZeros<uint64_t>::Trailing(mask) / 4;
+			}
+			pos += BLOCK_SIZE;
+		}
+		return pos;
+#else
+		while (pos + BLOCK_SIZE < end) {
+			auto value = Load<uint64_t>(const_data_ptr_cast(buffer + pos));
+			if (ContainsZeroByte((value ^ c0) & (value ^ c1) & (value ^ c2) & (value ^ c3))) {
+				return pos;
+			}
+			pos += BLOCK_SIZE;
+		}
+		return pos;
+#endif
+	}
+
+	//! Returns the position of the first byte in buffer[pos, end) that is equal to c0 or c1, see above
+	static inline idx_t SkipUntil(const char *buffer, const idx_t pos, const idx_t end, const uint64_t c0,
+	                              const uint64_t c1) {
+		return SkipUntil(buffer, pos, end, c0, c1, c0, c1);
+	}
+
+private:
+#if defined(DUCKDB_CSV_SSE2) || defined(DUCKDB_CSV_NEON)
+	//! The number of bytes classified at once
+	static constexpr idx_t BLOCK_SIZE = 16;
+#else
+	static constexpr idx_t BLOCK_SIZE = 8;
+
+	static inline bool ContainsZeroByte(uint64_t v) {
+		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
+	}
+#endif
+};
+
+} // namespace duckdb
@@ -8,13 +8,16 @@
 
 #pragma once
 
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/column_binding.hpp"
 
 namespace duckdb {
+class BlockedBloomFilter;
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -30,6 +33,10 @@ struct JoinFilterGlobalState {
 
 	//! Global Min/Max aggregates for filter pushdown
 	unique_ptr<GlobalUngroupedAggregateState> global_aggregate_state;
+	//! The Bloom filter over the build-side keys (if any) - pushed once the hash table is finalized
+	shared_ptr<BlockedBloomFilter> bloom_filter;
+	//! The filter for which the Bloom filter was built
+	optional_idx bloom_filter_idx;
 };
 
 struct JoinFilterLocalState {
@@ -53,7 +60,10 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	//! Pushes the min/max filters, and sets up a Bloom filter in the hash table if it can filter the probe side
+	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op, JoinHashTable &ht) const;
+	//! Pushes the Bloom filter (if any) after it has been filled in by the hash table finalize
+	void PushBloomFilter(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
 };
 
 } // namespace duckdb
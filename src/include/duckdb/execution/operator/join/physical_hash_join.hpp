@@ -52,6 +52,9 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The table indexes of the scans on the build side, used to report the actual build size to the optimizer.
+	//! Only set when adaptive re-optimization is enabled
+	vector<idx_t> build_table_indexes;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
@@ -197,12 +197,18 @@ public:
 	virtual void Finalize(WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate) const {
 	}
 
+	//! Evaluate the function for a chunk. If bounds_source is set, the frame bounds it computed for this chunk are
+	//! reused instead of computing them again (see frame_source).
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
-	              WindowExecutorGlobalState &gstate) const;
+	              WindowExecutorGlobalState &gstate,
+	              optional_ptr<WindowExecutorLocalState> bounds_source = nullptr) const;
 
 	// The function
 	const BoundWindowExpression &wexpr;
 	ClientContext &context;
+	//! The index of an earlier executor with the same frame whose bounds this executor reuses
+	//! (DConstants::INVALID_INDEX if the bounds are computed by this executor)
+	idx_t frame_source = DConstants::INVALID_INDEX;
 
 protected:
 	virtual void EvaluateInternal(WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate, Vector &result,
@@ -116,6 +116,19 @@ public:
 	              Vector &result, idx_t count, idx_t row_idx) const override;
 };
 
+//! Evaluates frames whose boundaries only move forward (e.g., ROWS BETWEEN 99 PRECEDING AND CURRENT ROW)
+//! with two stacks of partial aggregates, so each row costs an amortised constant number of combines
+class WindowSlidingAggregator : public WindowAggregator {
+public:
+	WindowSlidingAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
+	                        const LogicalType &result_type_p, const WindowExcludeMode exclude_mode_p);
+	~WindowSlidingAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState(const WindowAggregatorState &gstate) const override;
+	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx) const override;
+};
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
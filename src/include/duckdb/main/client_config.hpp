@@ -104,6 +104,13 @@ struct ClientConfig {
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
+	//! The maximum amount of temporary memory that the operators of a single query can reserve. Default: no limit.
+	idx_t query_memory_limit = DConstants::INVALID_INDEX;
+	//! The time (in milliseconds) a query waits to be admitted by query admission control. Default: one minute.
+	idx_t query_admission_timeout = 60000;
+	//! The factor by which the cardinality of a hash join build side can deviate from its estimate before the query is
+	//! re-optimized using the observed cardinality. Default: 0 (disabled).
+	double adaptive_reoptimization_threshold = 0;
 
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
@@ -227,6 +227,12 @@ private:
 	                                                                shared_ptr<PreparedStatementData> statement_p,
 	                                                                const PendingQueryParameters &parameters);
 	void CheckIfPreparedStatementIsExecutable(PreparedStatementData &statement);
+	//! Creates the executor (and progress bar) that executes the statement of the active query
+	void InitializeExecutor(ClientContextLock &lock, PreparedStatementData &statement, bool stream_result);
+	//! Whether or not the active query can be re-optimized when the executor observes a misestimated cardinality
+	bool CanReoptimize(PreparedStatementData &statement, bool stream_result);
+	//! Cancels the execution of the active query, and plans and starts it again using the observed cardinalities
+	void ReoptimizeQuery(ClientContextLock &lock);
 
 	//! Internally prepare a SQL statement. Caller must hold the context_lock.
 	shared_ptr<PreparedStatementData>
@@ -292,8 +298,16 @@ public:
 	~ClientContextLock() {
 	}
 
+	//! Temporarily release the context lock, e.g. while the query waits on other connections
+	void Unlock() {
+		client_guard.unlock();
+	}
+	void Lock() {
+		client_guard.lock();
+	}
+
 private:
-	lock_guard<mutex> client_guard;
+	unique_lock<mutex> client_guard;
 };
 
 } // namespace duckdb
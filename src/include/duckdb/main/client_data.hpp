@@ -18,6 +18,7 @@
 namespace duckdb {
 class AttachedDatabase;
 class BufferedFileWriter;
+class CardinalityFeedback;
 class ClientContext;
 class CatalogSearchPath;
 class FileOpener;
@@ -49,6 +50,9 @@ struct ClientData {
 	//! The random generator used by random(). Its seed value can be set by setseed().
 	unique_ptr<RandomEngine> random_engine;
 
+	//! The cardinalities observed while executing the current query, used when the query is re-optimized
+	unique_ptr<CardinalityFeedback> cardinality_feedback;
+
 	//! The catalog search path
 	unique_ptr<CatalogSearchPath> catalog_search_path;
 
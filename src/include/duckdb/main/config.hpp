@@ -14,6 +14,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
@@ -157,11 +158,19 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress blocks (adaptively, with ZSTD) that are written to the temporary directory
+	bool temp_file_compression = false;
+	//! The maximum memory used to cache the results of read-only queries (0 = disabled)
+	idx_t query_result_cache_size = 0;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool buffer_manager_track_eviction_timestamps = false;
+	//! The policy used to pick the blocks that are evicted from the buffer pool
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	//! Whether new queries wait until the memory they are estimated to need fits next to the running queries
+	bool query_admission_control = false;
 	//! Whether or not to allow printing unredacted secrets
 	bool allow_unredacted_secrets = false;
 	//! The collation type of the database
@@ -25,6 +25,7 @@ class ConnectionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class QueryResultCache;
 struct AttachInfo;
 struct AttachOptions;
 class DatabaseFileSystem;
@@ -54,6 +55,7 @@ public:
 	DUCKDB_API FileSystem &GetFileSystem();
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
+	DUCKDB_API QueryResultCache &GetQueryResultCache();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
 	DUCKDB_API ValidChecker &GetValidChecker();
 	DUCKDB_API void SetExtensionLoaded(const string &extension_name, ExtensionInstallInfo &install_info);
@@ -85,6 +87,7 @@ private:
 	unique_ptr<DatabaseManager> db_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<QueryResultCache> query_result_cache;
 	unique_ptr<ConnectionManager> connection_manager;
 	unordered_map<string, ExtensionInfo> loaded_extensions_info;
 	ValidChecker db_validity;
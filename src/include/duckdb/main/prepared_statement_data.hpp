@@ -20,6 +20,7 @@ namespace duckdb {
 class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
+struct QueryResultCacheInfo;
 class SQLStatement;
 
 class PreparedStatementData {
@@ -45,6 +46,8 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! The fingerprint of the plan, if its result can be stored in the query result cache
+	unique_ptr<QueryResultCacheInfo> result_cache_info;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
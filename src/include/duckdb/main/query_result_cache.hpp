@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ColumnDataCollection;
+class DatabaseInstance;
+class LogicalOperator;
+class PreparedStatementData;
+struct DataTableInfo;
+struct StatementProperties;
+
+//! The fingerprint of a plan whose result can be cached, together with the tables the plan reads from
+struct QueryResultCacheInfo {
+	//! The serialized (optimized) logical plan, followed by the catalog versions it was bound against
+	string fingerprint;
+	//! The tables scanned by the plan
+	vector<weak_ptr<DataTableInfo>> tables;
+};
+
+//! The key of a single execution of a cacheable plan
+struct QueryResultCacheKey {
+	//! The fingerprint of the plan, followed by the parameter values, settings and table versions
+	string key;
+	//! The tables read by the query, together with the commit id of their most recent modification
+	vector<pair<weak_ptr<DataTableInfo>, transaction_t>> tables;
+};
+
+//! The QueryResultCache holds the materialized results of read-only queries, keyed on the optimized plan of the query
+//! and the commit versions of the tables the query reads from. Entries are dropped when a commit modifies any of
+//! these tables, or in least-recently-used order when the cache exceeds its memory limit. The cached results are
+//! allocated through the buffer manager, and can be evicted to the temporary directory under memory pressure.
+class QueryResultCache {
+public:
+	explicit QueryResultCache(idx_t maximum_size);
+	~QueryResultCache();
+
+	static QueryResultCache &Get(ClientContext &context);
+	static QueryResultCache &Get(DatabaseInstance &db);
+
+public:
+	//! Whether or not the cache is enabled, i.e. whether it has a non-zero memory limit
+	bool IsEnabled() const {
+		return maximum_size > 0;
+	}
+	//! Sets the memory limit of the cache, evicting entries if required
+	void SetMaximumSize(idx_t maximum_size);
+	//! Returns the total size of the cached results
+	idx_t GetSize();
+
+	//! Fingerprints a plan - returns nullptr if the result of the plan cannot be cached
+	static unique_ptr<QueryResultCacheInfo> CreateCacheInfo(ClientContext &context, LogicalOperator &plan,
+	                                                        const StatementProperties &properties);
+	//! Creates the key for executing a statement with its currently bound parameters - returns nullptr if the cache
+	//! cannot be used within the current transaction
+	static unique_ptr<QueryResultCacheKey> CreateCacheKey(ClientContext &context,
+	                                                      const PreparedStatementData &statement);
+
+	//! Returns the cached result for a key, or nullptr if there is none
+	shared_ptr<ColumnDataCollection> Lookup(const QueryResultCacheKey &key);
+	//! Adds a copy of the result of a query to the cache
+	void Insert(ClientContext &context, const QueryResultCacheKey &key, ColumnDataCollection &result);
+	//! Drops all entries that read from a table that has been modified after the entry was cached
+	void Invalidate();
+
+private:
+	struct CacheEntry {
+		string key;
+		vector<pair<weak_ptr<DataTableInfo>, transaction_t>> tables;
+		shared_ptr<ColumnDataCollection> result;
+		idx_t size;
+	};
+	using entry_iterator_t = list<CacheEntry>::iterator;
+
+	static bool IsValid(const vector<pair<weak_ptr<DataTableInfo>, transaction_t>> &tables);
+	void EvictInternal();
+	void EraseInternal(entry_iterator_t entry);
+
+private:
+	mutex lock;
+	//! The memory limit of the cache
+	atomic<idx_t> maximum_size;
+	//! The total size of the cached results
+	idx_t size;
+	//! The cached entries, ordered from most to least recently used
+	list<CacheEntry> entries;
+	//! Map of key -> entry
+	unordered_map<string, entry_iterator_t> entry_map;
+};
+
+} // namespace duckdb
@@ -61,6 +61,17 @@ struct AccessModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct AdaptiveReoptimizationThresholdSetting {
+	static constexpr const char *Name = "adaptive_reoptimization_threshold";
+	static constexpr const char *Description =
+	    "Re-optimize a query if the size of a hash join build side deviates from its estimate by more than this "
+	    "factor, or 0 to disable";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllowPersistentSecrets {
 	static constexpr const char *Name = "allow_persistent_secrets";
 	static constexpr const char *Description =
@@ -537,6 +548,46 @@ struct MaximumMemorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to evict blocks from memory: lru, or 2q to protect blocks that are re-used from scans";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory that the operators of a single query can reserve (e.g. 1GB), or none for no limit";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryAdmissionControlSetting {
+	static constexpr const char *Name = "query_admission_control";
+	static constexpr const char *Description =
+	    "Hold new queries until the memory they are estimated to need fits next to the memory of running queries";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryAdmissionTimeoutSetting {
+	static constexpr const char *Name = "query_admission_timeout";
+	static constexpr const char *Description =
+	    "The time (in milliseconds) a query waits to be admitted by query admission control before it fails";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct StreamingBufferSize {
 	static constexpr const char *Name = "streaming_buffer_size";
 	static constexpr const char *Description =
@@ -744,6 +795,16 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryResultCacheSizeSetting {
+	static constexpr const char *Name = "query_result_cache_size";
+	static constexpr const char *Description =
+	    "The maximum memory used to cache the results of read-only queries (e.g. 1GB), 0 disables the cache";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -782,6 +843,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether or not to compress blocks that are spilled to the temporary directory";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
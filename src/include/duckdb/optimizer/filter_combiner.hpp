@@ -35,6 +35,9 @@ public:
 	explicit FilterCombiner(ClientContext &context);
 	explicit FilterCombiner(Optimizer &optimizer);
 
+	//! The maximum number of values of an IN list that is pushed into a scan as a disjunction of equality filters
+	static constexpr const idx_t MAX_IN_LIST_FILTER_SIZE = 8;
+
 	ClientContext &context;
 
 public:
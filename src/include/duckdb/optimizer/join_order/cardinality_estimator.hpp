@@ -103,6 +103,8 @@ public:
 	void InitEquivalentRelations(const vector<unique_ptr<FilterInfo>> &filter_infos);
 
 	void InitCardinalityEstimatorProps(optional_ptr<JoinRelationSet> set, RelationStats &stats);
+	//! Use the cardinality that was observed while executing the query instead of estimating it
+	void SetObservedCardinality(JoinRelationSet &set, double cardinality);
 
 	//! cost model needs estimated cardinalities to the fraction since the formula captures
 	//! distinct count selectivities and multiplicities. Hence the template
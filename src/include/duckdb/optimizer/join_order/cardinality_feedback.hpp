@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+
+//! CardinalityFeedback holds the cardinalities of intermediate results that were observed while executing a query.
+//! When a query is re-optimized, the join order optimizer uses them instead of its own estimates.
+//! Intermediate results are identified by the table indexes of the base tables they contain.
+class CardinalityFeedback {
+public:
+	static CardinalityFeedback &Get(ClientContext &context);
+
+	//! Records the observed cardinality of the intermediate result containing the given base tables
+	void AddObservation(const vector<idx_t> &table_indexes, idx_t cardinality);
+	//! Returns the observed cardinality of the intermediate result containing the given base tables (if any)
+	optional_idx GetObservation(const vector<idx_t> &table_indexes);
+	//! Returns all observations
+	map<vector<idx_t>, idx_t> GetObservations();
+	bool HasObservations();
+	void Clear();
+
+	//! Returns the (sorted) table indexes of the base tables that are scanned by the plan
+	static vector<idx_t> GetTableIndexes(LogicalOperator &op);
+
+private:
+	mutex lock;
+	map<vector<idx_t>, idx_t> observations;
+};
+
+} // namespace duckdb
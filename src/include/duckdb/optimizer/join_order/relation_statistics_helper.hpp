@@ -13,6 +13,7 @@
 namespace duckdb {
 
 class CardinalityEstimator;
+class HistogramStatistics;
 
 struct DistinctCount {
 	idx_t distinct_count;
@@ -47,6 +48,10 @@ public:
 public:
 	static idx_t InspectConjunctionAND(idx_t cardinality, idx_t column_index, ConjunctionAndFilter &filter,
 	                                   BaseStatistics &base_stats);
+	//! Estimates the selectivity of a table filter using the histogram statistics of the column. Returns false if
+	//! the filter cannot be estimated using the histogram.
+	static bool EstimateSelectivity(TableFilter &filter, HistogramStatistics &histogram, idx_t distinct_count,
+	                                double &selectivity);
 	//	static idx_t InspectConjunctionOR(idx_t cardinality, idx_t column_index, ConjunctionOrFilter &filter,
 	//	                                  BaseStatistics &base_stats);
 	//! Extract Statistics from a LogicalGet.
@@ -30,7 +30,6 @@ struct ProducerToken {
 
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
-	mutex producer_lock;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
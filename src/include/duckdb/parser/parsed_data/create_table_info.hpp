@@ -32,6 +32,8 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The columns on which the rows of the table are kept sorted when it is checkpointed
+	vector<string> sort_keys;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+namespace duckdb {
+class Vector;
+
+//! The BloomFilter filters out values whose hash is not contained in a BlockedBloomFilter, e.g., the hashes of the
+//! build side of a hash join. The filter can have false positives, but never false negatives.
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	BloomFilter(LogicalType key_type, shared_ptr<BlockedBloomFilter> filter);
+
+	//! The type of the hashed values - values of any other type cannot be probed
+	LogicalType key_type;
+	//! The (shared) Bloom filter
+	shared_ptr<BlockedBloomFilter> filter;
+
+public:
+	//! Probes the values in "vector" selected by "sel", and removes the ones that are not present from "sel"
+	idx_t Filter(Vector &vector, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -22,6 +22,17 @@ class ClientContext;
 class DatabaseInstance;
 class MetadataManager;
 
+//! A range of adjacent blocks that is read into a buffer (see BlockManager::ReadBlockRanges)
+struct BlockReadRange {
+	BlockReadRange(FileBuffer &buffer, block_id_t start_block, idx_t block_count)
+	    : buffer(buffer), start_block(start_block), block_count(block_count) {
+	}
+
+	reference<FileBuffer> buffer;
+	block_id_t start_block;
+	idx_t block_count;
+};
+
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
 class BlockManager {
@@ -56,6 +67,13 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Read the content of several ranges of blocks from disk. Block managers can issue the reads of all ranges at
+	//! the same time.
+	virtual void ReadBlockRanges(vector<BlockReadRange> &ranges) {
+		for (auto &range : ranges) {
+			ReadBlocks(range.buffer.get(), range.start_block, range.block_count);
+		}
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -138,6 +138,12 @@ private:
 	BufferPoolReservation memory_charge;
 	//! Does the block contain any memory pointers?
 	const char *unswizzled;
+	//! Whether the block was pinned again while it was in memory (2Q eviction policy)
+	bool frequently_used;
+	//! Whether the block was loaded by a prefetch, and has not been pinned since
+	bool prefetched;
+	//! The index of the eviction queue that holds the latest eviction node of this block
+	uint8_t eviction_queue_idx;
 };
 
 } // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -58,6 +59,15 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Set the policy used to pick the blocks that are evicted
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
+	//! Returns the number of pins of blocks with the given tag that found the block in memory (hits), or that had to
+	//! load it (misses)
+	idx_t GetBufferHits(MemoryTag tag) const;
+	idx_t GetBufferMisses(MemoryTag tag) const;
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -73,6 +83,10 @@ protected:
 	                                   unique_ptr<FileBuffer> *buffer = nullptr);
 	virtual EvictionResult EvictBlocksInternal(EvictionQueue &queue, MemoryTag tag, idx_t extra_memory,
 	                                           idx_t memory_limit, unique_ptr<FileBuffer> *buffer = nullptr);
+	//! Evict blocks from the protected queue until the currently used memory + extra_memory fit, or until the
+	//! protected blocks no longer exceed their share of the memory limit
+	EvictionResult EvictProtectedBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
+	                                    unique_ptr<FileBuffer> *buffer);
 
 	//! Purge all blocks that haven't been pinned within the last N seconds
 	idx_t PurgeAgedBlocks(uint32_t max_age_sec);
@@ -84,8 +98,15 @@ protected:
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	//! Gets the eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Gets the index of the eviction queue that the block is added to when it is unpinned
+	uint8_t GetEvictionQueueIndex(const BlockHandle &handle) const;
+	//! Increments the dead nodes for the queue that holds the latest eviction node of the block
+	void IncrementDeadNodes(const BlockHandle &handle);
+	//! Registers a pin of the block, which must be locked. "loaded" indicates whether the block was already in memory.
+	//! With the 2Q policy, blocks that are pinned again while they are in memory are moved to the protected queue.
+	void RegisterPin(BlockHandle &handle, bool loaded);
+	//! Removes the block from the protected blocks, called when the block is unloaded or destroyed
+	void UnprotectBlock(BlockHandle &handle);
 
 protected:
 	enum class MemoryUsageCaches {
@@ -131,6 +152,27 @@ protected:
 		void UpdateUsedMemory(MemoryTag tag, int64_t size);
 	};
 
+	struct PinStatistics {
+		//! Like MemoryUsage, the counters are spread over caches based on the current cpu to avoid contention
+		static constexpr idx_t PIN_STATISTICS_CACHE_COUNT = 64;
+		using PinCounters = array<atomic<idx_t>, MEMORY_TAG_COUNT>;
+
+		//! the number of pins that found the block in memory
+		array<PinCounters, PIN_STATISTICS_CACHE_COUNT> hits;
+		//! the number of pins that had to load the block
+		array<PinCounters, PIN_STATISTICS_CACHE_COUNT> misses;
+
+		PinStatistics();
+
+		void RegisterPin(MemoryTag tag, bool hit);
+		idx_t GetCount(const array<PinCounters, PIN_STATISTICS_CACHE_COUNT> &counters, MemoryTag tag) const;
+	};
+
+	//! The index of the eviction queue holding the blocks that were re-used while they were in memory (2Q policy)
+	static constexpr idx_t PROTECTED_QUEUE_INDEX = FILE_BUFFER_TYPE_COUNT;
+	//! The share of the memory limit that the blocks in the protected queue can occupy before they are evicted first
+	static constexpr double PROTECTED_MEMORY_RATIO = 0.75;
+
 	//! The lock for changing the memory limit
 	mutex limit_lock;
 	//! The maximum amount of memory that the buffer manager can keep (in bytes)
@@ -145,6 +187,12 @@ protected:
 	//! and only updates the global counter when the cache value exceeds a threshold.
 	//! Therefore, the statistics may have slight differences from the actual memory usage.
 	mutable MemoryUsage memory_usage;
+	//! The policy used to pick the blocks that are evicted
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! The memory used by the loaded blocks in the protected queue
+	atomic<idx_t> protected_memory;
+	//! Buffer hits and misses per memory tag
+	PinStatistics pin_statistics;
 };
 
 } // namespace duckdb
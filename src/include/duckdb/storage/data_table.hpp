@@ -182,6 +182,10 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Get the histogram statistics of a physical column within the table (if they have been collected)
+	unique_ptr<HistogramStatistics> GetHistogram(column_t column_id);
+	//! Sets the histogram statistics of a physical column within the table
+	void SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram);
 
 	//! Obtains a shared lock to prevent checkpointing while operations are running
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
@@ -218,6 +222,8 @@ public:
 	void AddIndex(unique_ptr<Index> index);
 	bool HasForeignKeyIndex(const vector<PhysicalIndex> &keys, ForeignKeyType type);
 	void SetIndexStorageInfo(vector<IndexStorageInfo> index_storage_info);
+	//! Sets the columns on which the rows of the table are sorted when the table is checkpointed
+	void SetSortKeys(vector<PhysicalIndex> sort_keys);
 	void VacuumIndexes();
 	void CleanupAppend(transaction_t lowest_transaction, idx_t start, idx_t count);
 
@@ -147,8 +147,9 @@ protected:
 	//! overwrites the data within with garbage. Any readers that do not hold the pin will notice
 	void VerifyZeroReaders(shared_ptr<BlockHandle> &handle);
 
+	//! Read ranges of adjacent blocks (first block, block count) in a single batch, and load them into their handles
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-	               block_id_t first_block, block_id_t last_block);
+	               const vector<pair<block_id_t, idx_t>> &ranges);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
@@ -10,6 +10,7 @@
 
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
 
 namespace duckdb {
 class Serializer;
@@ -17,7 +18,8 @@ class Serializer;
 class ColumnStatistics {
 public:
 	explicit ColumnStatistics(BaseStatistics stats_p);
-	ColumnStatistics(BaseStatistics stats_p, unique_ptr<DistinctStatistics> distinct_stats_p);
+	ColumnStatistics(BaseStatistics stats_p, unique_ptr<DistinctStatistics> distinct_stats_p,
+	                 unique_ptr<HistogramStatistics> histogram_p = nullptr);
 
 public:
 	static shared_ptr<ColumnStatistics> CreateEmptyStats(const LogicalType &type);
@@ -32,6 +34,10 @@ public:
 	DistinctStatistics &DistinctStats();
 	void SetDistinct(unique_ptr<DistinctStatistics> distinct_stats);
 
+	bool HasHistogram();
+	HistogramStatistics &Histogram();
+	void SetHistogram(unique_ptr<HistogramStatistics> histogram);
+
 	shared_ptr<ColumnStatistics> Copy() const;
 
 	void Serialize(Serializer &serializer) const;
@@ -41,6 +47,8 @@ private:
 	BaseStatistics stats;
 	//! The approximate count distinct stats of the column
 	unique_ptr<DistinctStatistics> distinct_stats;
+	//! The most common values and histogram of the column, collected by ANALYZE
+	unique_ptr<HistogramStatistics> histogram;
 };
 
 } // namespace duckdb
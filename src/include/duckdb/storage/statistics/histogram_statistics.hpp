@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/histogram_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class Serializer;
+class Deserializer;
+
+//! HistogramStatistics describes the value distribution of a column with a list of most common values (MCVs) and an
+//! equi-depth histogram over the remaining non-null values. They are built from a sample of the column by ANALYZE.
+//! All frequencies are fractions of the total row count of the table.
+class HistogramStatistics {
+public:
+	HistogramStatistics(LogicalType type, vector<Value> mcv_values, vector<double> mcv_frequencies,
+	                    vector<double> bounds, double histogram_fraction);
+
+	//! The type of the column
+	LogicalType type;
+	//! The most common values of the column
+	vector<Value> mcv_values;
+	//! The fraction of rows that have the corresponding most common value
+	vector<double> mcv_frequencies;
+	//! The bucket bounds of the histogram over the remaining values - every bucket holds the same number of rows
+	vector<double> bounds;
+	//! The fraction of rows that is covered by the histogram
+	double histogram_fraction;
+
+public:
+	//! Builds the statistics from a (weighted) sample of the column. "total_weight" is the sum of the weights of all
+	//! sampled rows, including those that are NULL and are thus not part of "values"
+	static unique_ptr<HistogramStatistics> Build(const LogicalType &type, const vector<Value> &values,
+	                                             const vector<double> &weights, double total_weight);
+
+	//! Whether or not the constant can be estimated using these statistics
+	bool CanEstimate(const Value &constant) const;
+	//! The estimated fraction of rows that are equal to the constant
+	double EstimateEquality(const Value &constant, idx_t distinct_count) const;
+	//! The estimated fraction of rows that are smaller than (or equal to) the constant
+	double EstimateLessThan(const Value &constant, bool inclusive) const;
+	//! The fraction of rows that is not NULL
+	double NonNullFraction() const;
+	//! The number of distinct values that, if they were uniformly distributed, produce the same join sizes as the
+	//! (skewed) values of the column
+	idx_t EstimateJoinDistinctCount(idx_t distinct_count) const;
+
+	unique_ptr<HistogramStatistics> Copy() const;
+
+	static bool TypeIsSupported(const LogicalType &type);
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<HistogramStatistics> Deserialize(Deserializer &deserializer);
+
+public:
+	//! The number of rows that is sampled per thread to build the statistics
+	static constexpr const idx_t SAMPLE_SIZE = 2048;
+	//! The maximum number of buckets of the histogram
+	static constexpr const idx_t MAX_BUCKET_COUNT = 64;
+	//! The maximum number of most common values
+	static constexpr const idx_t MAX_MCV_COUNT = 16;
+
+private:
+	static bool TryGetNumericValue(const Value &value, double &result);
+	//! The fraction of the rows covered by the histogram that is smaller than (or equal to) the value
+	double HistogramLessThan(double value, bool inclusive) const;
+};
+
+} // namespace duckdb
@@ -33,7 +33,7 @@ public:
 
 	//! Revert the commit
 	virtual void RevertCommit() = 0;
-	// Make the commit persistent
+	// Write the commit to the WAL - the commit is persistent once the WAL is synced (see WriteAheadLog::SyncUpTo)
 	virtual void FlushCommit() = 0;
 };
 
@@ -75,6 +75,10 @@ public:
 	optional_ptr<WriteAheadLog> GetWAL();
 	//! Deletes the WAL file, and resets the unique pointer.
 	void ResetWAL();
+	//! Gets the statistics on the replay of the WAL when the database was loaded
+	WALReplayStatistics &GetReplayStatistics() {
+		return replay_statistics;
+	}
 
 	//! Returns the database file path
 	string GetDBPath() const {
@@ -110,6 +114,8 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Statistics on the replay of the WAL when the database was loaded
+	WALReplayStatistics replay_statistics;
 
 public:
 	template <class TARGET>
@@ -49,6 +49,14 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! The commit id of the most recent transaction that modified the data of this table (or 0)
+	transaction_t GetLastCommitId() const {
+		return last_commit_id;
+	}
+	void SetLastCommitId(transaction_t commit_id) {
+		last_commit_id = commit_id;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +74,8 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the most recent transaction that modified the data of this table
+	atomic<transaction_t> last_commit_id;
 };
 
 } // namespace duckdb
@@ -91,6 +91,14 @@ public:
 
 	void Checkpoint(TableDataWriter &writer, TableStatistics &global_stats);
 
+	//! Sets the columns on which the row groups are sorted when the collection is checkpointed
+	void SetSortKeys(vector<PhysicalIndex> sort_keys);
+	const vector<PhysicalIndex> &GetSortKeys() const {
+		return sort_keys;
+	}
+	//! Sort the rows that were modified since the last checkpoint (and any sorted row groups that overlap with them)
+	void SortRowGroups(TableDataWriter &writer, vector<SegmentNode<RowGroup>> &segments);
+
 	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
 	                           vector<SegmentNode<RowGroup>> &segments);
 	bool ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx);
@@ -112,6 +120,8 @@ public:
 	void CopyStats(TableStatistics &stats);
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	unique_ptr<HistogramStatistics> CopyHistogram(column_t column_id);
+	void SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram);
 
 	AttachedDatabase &GetAttached();
 	BlockManager &GetBlockManager() {
@@ -128,6 +138,9 @@ public:
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Marks all rows starting from the given row as possibly out of order
+	void MarkUnsorted(idx_t row_idx);
+	bool IsSortKey(idx_t column_idx) const;
 
 private:
 	//! BlockManager
@@ -145,6 +158,10 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! The columns on which the row groups are sorted when checkpointing (if any)
+	vector<PhysicalIndex> sort_keys;
+	//! The first row that was appended, or of which a sort key was updated, since the rows were last sorted
+	atomic<idx_t> unsorted_row_start;
 };
 
 } // namespace duckdb
@@ -45,6 +45,8 @@ public:
 	void CopyStats(TableStatistics &other);
 	void CopyStats(TableStatisticsLock &lock, TableStatistics &other);
 	unique_ptr<BaseStatistics> CopyStats(idx_t i);
+	//! Copies the histogram statistics of a column (if any)
+	unique_ptr<HistogramStatistics> CopyHistogram(idx_t i);
 	//! Get a reference to the stats - this requires us to hold the lock.
 	//! The reference can only be safely accessed while the lock is held
 	ColumnStatistics &GetStats(TableStatisticsLock &lock, idx_t i);
@@ -11,6 +11,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -19,6 +20,24 @@
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// TemporaryBufferSize
+//===--------------------------------------------------------------------===//
+
+//! The size of the slots in a temporary file. Compressed blocks are written to the smallest slot they fit in,
+//! uncompressed blocks are written to DEFAULT slots (which have the size of a block allocation)
+enum class TemporaryBufferSize : idx_t {
+	INVALID = 0,
+	S32K = 32768,
+	S64K = 65536,
+	S96K = 98304,
+	S128K = 131072,
+	S160K = 163840,
+	S192K = 196608,
+	S224K = 229376,
+	DEFAULT = DEFAULT_BLOCK_ALLOC_SIZE
+};
+
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
@@ -27,7 +46,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -48,6 +67,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of a block on disk, used to track the size of the temporary files
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -56,9 +77,12 @@ private:
 
 // FIXME: should be optional_idx
 struct TemporaryFileIndex {
-	explicit TemporaryFileIndex(idx_t file_index = DConstants::INVALID_INDEX,
+	explicit TemporaryFileIndex(TemporaryBufferSize size = TemporaryBufferSize::INVALID,
+	                            idx_t file_index = DConstants::INVALID_INDEX,
 	                            idx_t block_index = DConstants::INVALID_INDEX);
 
+	//! The slot size of the file the block is stored in
+	TemporaryBufferSize size;
 	idx_t file_index;
 	idx_t block_index;
 
@@ -75,7 +99,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    TemporaryBufferSize size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,7 +112,10 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
+	//! Writes an uncompressed buffer to a DEFAULT-sized slot
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes a compressed buffer (prefixed with its compressed size) to a slot of this file
+	void WriteTemporaryFile(AllocatedData &compressed_buffer, TemporaryFileIndex index);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
@@ -104,11 +131,48 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The slot size of this file
+	TemporaryBufferSize size;
+	//! The size of a slot in bytes
+	idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
 };
 
+//===--------------------------------------------------------------------===//
+// TemporaryFileCompressionAdaptivity
+//===--------------------------------------------------------------------===//
+
+//! Chooses the ZSTD level that is used to compress spilled blocks, based on the observed time it took to compress
+//! and write blocks with each of the levels: slow (e.g., network) disks favor higher levels, fast disks lower ones
+class TemporaryFileCompressionAdaptivity {
+public:
+	//! The number of ZSTD levels we choose from
+	static constexpr const idx_t LEVEL_COUNT = 4;
+	//! Every EXPLORATION_INTERVAL writes we try a level adjacent to the best one
+	static constexpr const idx_t EXPLORATION_INTERVAL = 16;
+
+public:
+	TemporaryFileCompressionAdaptivity();
+
+	//! Returns the index of the level to compress the next block with
+	idx_t GetLevelIndex();
+	//! Records the time (in seconds) that compressing and writing a block took with the given level
+	void Update(idx_t level_idx, double elapsed);
+	//! Converts a level index to a ZSTD compression level
+	static int GetZSTDLevel(idx_t level_idx);
+
+private:
+	mutex lock;
+	//! The exponentially weighted moving average of the time a write took, per level
+	double average_time[LEVEL_COUNT];
+	//! The level we currently consider the best
+	idx_t best_level;
+	//! The number of writes so far
+	idx_t write_count;
+};
+
 //===--------------------------------------------------------------------===//
 // TemporaryDirectoryHandle
 //===--------------------------------------------------------------------===//
@@ -159,23 +223,30 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Tries to compress the buffer into "compressed_buffer", returns the size of the slot the result fits in.
+	//! Returns TemporaryBufferSize::DEFAULT if the buffer should be written uncompressed.
+	TemporaryBufferSize CompressBuffer(idx_t level_idx, FileBuffer &buffer, AllocatedData &compressed_buffer);
+	//! Obtains a free slot of the given size, creating a new temporary file if required
+	TemporaryFileIndex GetFreeSlot(TemporaryBufferSize size, block_id_t block_id, TemporaryFileHandle *&handle);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
-	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
+	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, TemporaryFileIndex index);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
-	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
+	void EraseFileHandle(TemporaryManagerLock &, TemporaryFileIndex index);
 
 private:
 	DatabaseInstance &db;
 	mutex manager_lock;
 	//! The temporary directory
 	string temp_directory;
-	//! The set of active temporary file handles
-	unordered_map<idx_t, unique_ptr<TemporaryFileHandle>> files;
+	//! The set of active temporary file handles, per slot size
+	map<TemporaryBufferSize, unordered_map<idx_t, unique_ptr<TemporaryFileHandle>>> files;
 	//! map of block_id -> temporary file position
 	unordered_map<block_id_t, TemporaryFileIndex> used_blocks;
-	//! Manager of in-use temporary file indexes
-	BlockIndexManager index_manager;
+	//! Manager of in-use temporary file indexes, per slot size
+	map<TemporaryBufferSize, BlockIndexManager> index_managers;
+	//! Chooses the level that spilled blocks are compressed with
+	TemporaryFileCompressionAdaptivity compression_adaptivity;
 	//! The size in bytes of the temporary files that are currently alive
 	atomic<idx_t> size_on_disk;
 	//! The max amount of disk space that can be used
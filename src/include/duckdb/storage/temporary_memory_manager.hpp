@@ -9,22 +9,71 @@
 #pragma once
 
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class ClientContext;
 class TemporaryMemoryManager;
 
+//! The temporary memory of a single query, i.e., of the TemporaryMemoryStates registered by its operators
+struct TemporaryMemoryQuery {
+	TemporaryMemoryQuery(ClientContext &context, string query);
+
+	//! The context that runs the query
+	ClientContext &context;
+	//! The query string
+	string query;
+	//! The maximum memory that the states of the query can reserve (query_memory_limit setting)
+	idx_t memory_limit;
+	//! The memory the query is estimated to need, used for admission control
+	idx_t estimated_memory;
+	//! Whether the query is waiting to be admitted
+	bool waiting;
+	//! Whether the query holds a TemporaryMemoryAdmission
+	bool admitted;
+	//! When the query started waiting to be admitted
+	time_point<high_resolution_clock> wait_start;
+	//! How long the query waited to be admitted (in seconds)
+	double wait_time;
+	//! The number of active states of the query
+	idx_t state_count;
+	//! The sum of reservations of the active states of the query
+	idx_t reservation;
+	//! The sum of the remaining size of the active states of the query
+	idx_t remaining_size;
+};
+
+//! Admission of a query by the TemporaryMemoryManager. The admission is released when this goes out of scope
+class TemporaryMemoryAdmission {
+	friend class TemporaryMemoryManager;
+
+private:
+	TemporaryMemoryAdmission(TemporaryMemoryManager &temporary_memory_manager, TemporaryMemoryQuery &query);
+
+public:
+	~TemporaryMemoryAdmission();
+
+private:
+	//! The TemporaryMemoryManager that admitted the query
+	TemporaryMemoryManager &temporary_memory_manager;
+	//! The admitted query
+	TemporaryMemoryQuery &query;
+};
+
 //! State of the temporary memory to be managed concurrently with other states
 //! As long as this is within scope, it is active
 class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, TemporaryMemoryQuery &query,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -48,6 +97,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The query that registered this state
+	TemporaryMemoryQuery &query;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -65,6 +116,7 @@ class TemporaryMemoryManager {
 	//! TemporaryMemoryState is a friend class so it can access the private methods of this class,
 	//! but it should not access the private fields!
 	friend class TemporaryMemoryState;
+	friend class TemporaryMemoryAdmission;
 
 public:
 	TemporaryMemoryManager();
@@ -82,12 +134,21 @@ private:
 	static constexpr double MAXIMUM_MEMORY_LIMIT_RATIO = 0.8;
 	//! The maximum ratio of the remaining memory that we reserve per TemporaryMemoryState
 	static constexpr double MAXIMUM_FREE_MEMORY_RATIO = 2.0 / 3.0;
+	//! How often a query that waits to be admitted checks whether it was interrupted or timed out
+	static constexpr int64_t ADMISSION_POLL_INTERVAL_MS = 10;
 
 public:
 	//! Get the TemporaryMemoryManager
 	static TemporaryMemoryManager &Get(ClientContext &context);
 	//! Register a TemporaryMemoryState
 	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Admit a query that is estimated to need "estimated_memory", waits until the memory fits next to the memory of
+	//! the queries that are already running. Queries that need less than the minimum reservation are admitted directly.
+	//! Throws if the query is not admitted within the query_admission_timeout.
+	unique_ptr<TemporaryMemoryAdmission> AdmitQuery(ClientContext &context, const string &query,
+	                                                idx_t estimated_memory);
+	//! Get the queries that are running (with active states or an admission) or waiting to be admitted
+	vector<TemporaryMemoryQuery> GetQueries();
 
 private:
 	//! Locks the TemporaryMemoryManager
@@ -105,6 +166,14 @@ private:
 	//! Computes optimal reservation of a TemporaryMemoryState based on a cost function
 	idx_t ComputeOptimalReservation(const TemporaryMemoryState &temporary_memory_state, idx_t free_memory,
 	                                idx_t lower_bound, idx_t upper_bound) const;
+	//! Get the query that runs in the context, or creates it (must hold the lock)
+	TemporaryMemoryQuery &GetOrCreateQuery(ClientContext &context, const string &query);
+	//! Removes the query if it has no active states and is not admitted or waiting anymore (must hold the lock)
+	void ReleaseQuery(TemporaryMemoryQuery &query);
+	//! Release the admission of a query (called by the destructor of TemporaryMemoryAdmission)
+	void ReleaseAdmission(TemporaryMemoryQuery &query);
+	//! Whether the query that waits to be admitted fits next to the queries that are running (must hold the lock)
+	bool CanAdmit(const TemporaryMemoryQuery &query) const;
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
 
@@ -127,6 +196,11 @@ private:
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
 	idx_t remaining_size;
+
+	//! The queries with active states, or that are admitted or waiting to be admitted
+	reference_map_t<ClientContext, TemporaryMemoryQuery> queries;
+	//! Notified when memory is released, so waiting queries can check whether they can be admitted
+	std::condition_variable memory_released;
 };
 
 } // namespace duckdb
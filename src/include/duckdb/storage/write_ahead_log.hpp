@@ -20,6 +20,8 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -37,6 +39,32 @@ class Transaction;
 class TransactionManager;
 class WriteAheadLogDeserializer;
 
+//! Statistics on the syncs of the WAL performed for committing transactions
+struct WALSyncStatistics {
+	//! The number of times the WAL was synced to disk for committing transactions
+	idx_t sync_count = 0;
+	//! The number of commits that waited for their WAL entries to be synced
+	idx_t commit_count = 0;
+	//! The largest number of commits that were waiting for a single sync
+	idx_t max_batch_size = 0;
+	//! The total time (in seconds) commits spent waiting for their WAL entries to be synced
+	double total_commit_wait = 0;
+	//! The longest time (in seconds) a single commit spent waiting for its WAL entries to be synced
+	double max_commit_wait = 0;
+};
+
+//! Statistics on the replay of the WAL when the database was loaded
+struct WALReplayStatistics {
+	//! The size of the WAL file that was found when loading the database
+	idx_t wal_size = 0;
+	//! The number of bytes of the WAL file that were replayed and committed
+	idx_t replayed_bytes = 0;
+	//! The number of transactions that were replayed and committed
+	idx_t replayed_transactions = 0;
+	//! The time (in seconds) it took to replay the WAL
+	double replay_time = 0;
+};
+
 //! The WriteAheadLog (WAL) is a log that is used to provide durability. Prior
 //! to committing a transaction it writes the changes the transaction made to
 //! the database to the log, which can then be replayed upon startup in case the
@@ -110,7 +138,16 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Write a flush marker and sync the WAL to disk
 	void Flush();
+	//! Write a flush marker and write all buffered entries to the file, without syncing the file to disk. Returns
+	//! the size the WAL has to be synced up to for the flushed entries to be durable.
+	idx_t WriteFlush();
+	//! Sync the WAL to disk up to (at least) the given size. Concurrent callers are batched (group commit): one of
+	//! them syncs the file on behalf of all waiting callers, the others wait for that sync to finish.
+	void SyncUpTo(idx_t size);
+	//! Returns the statistics on the syncs performed by SyncUpTo
+	WALSyncStatistics GetSyncStatistics();
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -121,6 +158,20 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+
+	//! Lock protecting the group commit state
+	mutex sync_lock;
+	//! Signaled when a sync finishes
+	std::condition_variable sync_finished;
+	//! Whether or not a sync is currently in progress
+	bool sync_in_progress = false;
+	//! The size up to which the WAL is known to be synced to disk
+	idx_t synced_size = 0;
+	//! The smallest size the WAL was truncated to while the current sync was in progress
+	idx_t truncated_size = 0;
+	//! The number of callers of SyncUpTo waiting for their entries to be synced
+	idx_t pending_syncs = 0;
+	WALSyncStatistics sync_statistics;
 };
 
 } // namespace duckdb
@@ -10,6 +10,7 @@
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -21,9 +22,11 @@
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/parameter_expression.hpp"
@@ -40,6 +43,7 @@
 #include "duckdb/planner/planner.hpp"
 #include "duckdb/planner/pragma_handler.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 
@@ -49,12 +53,22 @@ struct ActiveQueryContext {
 public:
 	//! The query that is currently being executed
 	string query;
+	//! The cached result that is scanned by the query (if any)
+	shared_ptr<ColumnDataCollection> cached_result;
+	//! The key under which the result of the query should be stored in the query result cache (if any)
+	unique_ptr<QueryResultCacheKey> result_cache_key;
+	//! The admission of the query by the TemporaryMemoryManager (if query admission control is enabled)
+	unique_ptr<TemporaryMemoryAdmission> admission;
 	//! Prepared statement data
 	shared_ptr<PreparedStatementData> prepared;
 	//! The query executor
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! A copy of the statement, used to re-plan the query when it is re-optimized during execution
+	unique_ptr<SQLStatement> unbound_statement;
+	//! The number of times the query was re-optimized during execution
+	idx_t reoptimization_count = 0;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -209,6 +223,7 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 		active_query->executor->CancelTasks();
 	}
 	active_query->progress_bar.reset();
+	CardinalityFeedback::Get(*this).Clear();
 
 	D_ASSERT(active_query.get());
 	active_query.reset();
@@ -298,6 +313,11 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	D_ASSERT(executor.HasResultCollector());
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
+	if (active_query->result_cache_key && result->type == QueryResultType::MATERIALIZED_RESULT &&
+	    !result->HasError()) {
+		auto &materialized = result->Cast<MaterializedQueryResult>();
+		QueryResultCache::Get(*this).Insert(*this, *active_query->result_cache_key, materialized.Collection());
+	}
 	if (!create_stream_result) {
 		CleanupInternal(lock, result.get(), false);
 	} else {
@@ -363,6 +383,11 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #endif
 	}
 
+	if (statement_type == StatementType::SELECT_STATEMENT && QueryResultCache::Get(*this).IsEnabled()) {
+		// fingerprint the plan, so we can cache its result
+		result->result_cache_info = QueryResultCache::CreateCacheInfo(*this, *plan, result->properties);
+	}
+
 	profiler.StartPhase("physical_planner");
 	// now convert logical query plan into a physical query plan
 	PhysicalPlanGenerator physical_planner(*this);
@@ -475,16 +500,61 @@ void ClientContext::CheckIfPreparedStatementIsExecutable(PreparedStatementData &
 	}
 }
 
-unique_ptr<PendingQueryResult>
-ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement_p,
-                                                const PendingQueryParameters &parameters) {
-	D_ASSERT(active_query);
-	auto &statement = *statement_p;
+static double EstimateMaterializedSize(idx_t cardinality, const vector<LogicalType> &types) {
+	// the hash or pointer that is stored with each row
+	idx_t row_width = sizeof(hash_t);
+	for (auto &type : types) {
+		row_width += GetTypeIdSize(type.InternalType());
+	}
+	return static_cast<double>(cardinality) * static_cast<double>(row_width);
+}
 
-	BindPreparedStatementParameters(statement, parameters);
+//! Estimates the memory that the operators that reserve temporary memory (hash joins and hash aggregates) need
+static double EstimateTemporaryMemory(const PhysicalOperator &op) {
+	double result = 0;
+	switch (op.type) {
+	case PhysicalOperatorType::HASH_JOIN: {
+		// the hash table holds the build side
+		auto &build = *op.children[1];
+		result += EstimateMaterializedSize(build.estimated_cardinality, build.types);
+		break;
+	}
+	case PhysicalOperatorType::HASH_GROUP_BY:
+		result += EstimateMaterializedSize(op.estimated_cardinality, op.types);
+		break;
+	default:
+		break;
+	}
+	for (auto &child : op.children) {
+		result += EstimateTemporaryMemory(*child);
+	}
+	return result;
+}
 
+bool ClientContext::CanReoptimize(PreparedStatementData &statement, bool stream_result) {
+	auto &client_config = ClientConfig::GetConfig(*this);
+	if (client_config.adaptive_reoptimization_threshold <= 0 || stream_result) {
+		return false;
+	}
+	if (active_query->reoptimization_count > 0 || active_query->cached_result) {
+		// a query is re-optimized at most once
+		return false;
+	}
+	if (statement.statement_type != StatementType::SELECT_STATEMENT ||
+	    !statement.properties.modified_databases.empty()) {
+		// only read-only queries can be restarted
+		return false;
+	}
+	return active_query->unbound_statement || statement.unbound_statement;
+}
+
+void ClientContext::InitializeExecutor(ClientContextLock &lock, PreparedStatementData &statement, bool stream_result) {
 	active_query->executor = make_uniq<Executor>(*this);
 	auto &executor = *active_query->executor;
+	auto &client_config = ClientConfig::GetConfig(*this);
+	if (CanReoptimize(statement, stream_result)) {
+		executor.EnableReoptimization(client_config.adaptive_reoptimization_threshold);
+	}
 	if (config.enable_progress_bar) {
 		progress_bar_display_create_func_t display_create_func = nullptr;
 		if (config.print_progress_bar) {
@@ -497,10 +567,7 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_
 		active_query->progress_bar->Start();
 		query_progress.Restart();
 	}
-	auto stream_result = parameters.allow_stream_result && statement.properties.allow_stream_result;
-
 	get_result_collector_t get_method = PhysicalResultCollector::GetResultCollector;
-	auto &client_config = ClientConfig::GetConfig(*this);
 	if (!stream_result && client_config.result_collector) {
 		get_method = client_config.result_collector;
 	}
@@ -508,8 +575,90 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_
 	auto collector = get_method(*this, statement);
 	D_ASSERT(collector->type == PhysicalOperatorType::RESULT_COLLECTOR);
 	executor.Initialize(std::move(collector));
+}
 
-	auto types = executor.GetTypes();
+void ClientContext::ReoptimizeQuery(ClientContextLock &lock) {
+	D_ASSERT(active_query->prepared);
+	auto &prepared = *active_query->prepared;
+	auto &unbound_statement =
+	    active_query->unbound_statement ? *active_query->unbound_statement : *prepared.unbound_statement;
+
+	// stop the execution of the current plan
+	active_query->executor->CancelTasks();
+	active_query->progress_bar.reset();
+
+	// plan the query again - the optimizer now uses the cardinalities that were observed during execution
+	auto &profiler = QueryProfiler::Get(*this);
+	profiler.StartPhase("adaptive_reoptimization");
+	case_insensitive_map_t<BoundParameterData> values;
+	for (auto &it : prepared.value_map) {
+		values.emplace(it.first, BoundParameterData(it.second->GetValue()));
+	}
+	auto new_prepared = CreatePreparedStatement(lock, active_query->query, unbound_statement.Copy(), &values);
+	new_prepared->Bind(std::move(values));
+	D_ASSERT(new_prepared->types == prepared.types);
+	profiler.EndPhase();
+
+	// the plan of the old executor refers to the old prepared statement, so it has to be destroyed first
+	active_query->executor.reset();
+	active_query->prepared = std::move(new_prepared);
+	active_query->reoptimization_count++;
+	InitializeExecutor(lock, *active_query->prepared, false);
+}
+
+unique_ptr<PendingQueryResult>
+ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement_p,
+                                                const PendingQueryParameters &parameters) {
+	D_ASSERT(active_query);
+	BindPreparedStatementParameters(*statement_p, parameters);
+
+	auto stream_result = parameters.allow_stream_result && statement_p->properties.allow_stream_result;
+	if (!stream_result && statement_p->result_cache_info) {
+		auto cache_key = QueryResultCache::CreateCacheKey(*this, *statement_p);
+		auto cached_result = cache_key ? QueryResultCache::Get(*this).Lookup(*cache_key) : nullptr;
+		if (cached_result) {
+			// the result of this query is cached: scan the cached result instead of executing the plan
+			auto cached_statement = make_shared_ptr<PreparedStatementData>(statement_p->statement_type);
+			cached_statement->names = statement_p->names;
+			cached_statement->types = statement_p->types;
+			cached_statement->properties = statement_p->properties;
+			cached_statement->plan =
+			    make_uniq<PhysicalColumnDataScan>(statement_p->types, PhysicalOperatorType::COLUMN_DATA_SCAN,
+			                                      cached_result->Count(), *cached_result);
+			active_query->cached_result = std::move(cached_result);
+			statement_p = std::move(cached_statement);
+		} else {
+			active_query->result_cache_key = std::move(cache_key);
+		}
+	}
+	auto &statement = *statement_p;
+
+	if (DBConfig::GetConfig(*this).options.query_admission_control) {
+		// hold the query until the memory it is estimated to need fits next to the memory of the running queries
+		auto estimated_memory = MinValue<double>(EstimateTemporaryMemory(*statement.plan),
+		                                         static_cast<double>(NumericLimits<idx_t>::Maximum() / 2));
+		auto waiting_query = active_query.get();
+		auto query = active_query->query;
+		// release the context lock while waiting for the memory of other connections, so they cannot deadlock on it
+		lock.Unlock();
+		unique_ptr<TemporaryMemoryAdmission> admission;
+		try {
+			admission = TemporaryMemoryManager::Get(*this).AdmitQuery(*this, query,
+			                                                           LossyNumericCast<idx_t>(estimated_memory));
+		} catch (...) {
+			lock.Lock();
+			throw;
+		}
+		lock.Lock();
+		if (active_query.get() != waiting_query) {
+			throw InvalidInputException("Query was cleaned up while it was waiting to be admitted");
+		}
+		active_query->admission = std::move(admission);
+	}
+
+	InitializeExecutor(lock, statement, stream_result);
+
+	auto types = active_query->executor->GetTypes();
 	D_ASSERT(types == statement.types);
 	D_ASSERT(!active_query->HasOpenResult());
 
@@ -554,6 +703,11 @@ PendingExecutionResult ClientContext::ExecuteTaskInternal(ClientContextLock &loc
 	bool invalidate_transaction = true;
 	try {
 		auto query_result = active_query->executor->ExecuteTask(dry_run);
+		if (!PendingQueryResult::IsResultReady(query_result) && active_query->executor->RequiresReoptimization()) {
+			// the cardinality of an intermediate result deviates from its estimate: restart with a better plan
+			ReoptimizeQuery(lock);
+			return PendingExecutionResult::RESULT_NOT_READY;
+		}
 		if (active_query->progress_bar) {
 			auto is_finished = PendingQueryResult::IsResultReady(query_result);
 			active_query->progress_bar->Update(is_finished);
@@ -733,6 +887,11 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
+	if (ClientConfig::GetConfig(*this).adaptive_reoptimization_threshold > 0 &&
+	    statement->type == StatementType::SELECT_STATEMENT) {
+		// keep a copy of the statement around, in case the query is re-optimized during execution
+		active_query->unbound_statement = statement->Copy();
+	}
 	// prepare the query for execution
 	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
 	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
@@ -58,6 +58,7 @@ bool DBConfigOptions::debug_print_bindings = false;
 
 static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
+    DUCKDB_LOCAL(AdaptiveReoptimizationThresholdSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
     DUCKDB_GLOBAL(CatalogErrorMaxSchema),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
@@ -105,6 +106,10 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(MaximumExpressionDepthSetting),
     DUCKDB_LOCAL(StreamingBufferSize),
     DUCKDB_GLOBAL(MaximumMemorySetting),
+    DUCKDB_GLOBAL(BufferEvictionPolicySetting),
+    DUCKDB_LOCAL(QueryMemoryLimitSetting),
+    DUCKDB_GLOBAL(QueryAdmissionControlSetting),
+    DUCKDB_LOCAL(QueryAdmissionTimeoutSetting),
     DUCKDB_GLOBAL(MaximumTempDirectorySize),
     DUCKDB_LOCAL(MergeJoinThreshold),
     DUCKDB_LOCAL(NestedLoopJoinThreshold),
@@ -123,11 +128,13 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
     DUCKDB_LOCAL(CustomProfilingSettings),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_GLOBAL(QueryResultCacheSizeSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
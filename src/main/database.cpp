@@ -17,6 +17,7 @@
 #include "duckdb/parser/parsed_data/attach_info.hpp"
 #include "duckdb/planner/extension_callback.hpp"
 #include "duckdb/storage/object_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 #include "duckdb/storage/storage_extension.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -59,6 +60,8 @@ DatabaseInstance::DatabaseInstance() {
 }
 
 DatabaseInstance::~DatabaseInstance() {
+	// drop any cached query results before destroying the tables they were computed from
+	query_result_cache.reset();
 	// destroy all attached databases
 	GetDatabaseManager().ResetDatabases(scheduler);
 	// destroy child elements
@@ -234,6 +237,7 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	}
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	query_result_cache = make_uniq<QueryResultCache>(config.options.query_result_cache_size);
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// initialize the secret manager
@@ -315,6 +319,10 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+QueryResultCache &DatabaseInstance::GetQueryResultCache() {
+	return *query_result_cache;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -393,6 +401,7 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
 		                                                 config.options.buffer_manager_track_eviction_timestamps);
 	}
+	config.buffer_pool->SetEvictionPolicy(config.options.buffer_eviction_policy);
 }
 
 DBConfig &DBConfig::GetConfig(ClientContext &context) {
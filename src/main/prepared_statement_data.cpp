@@ -5,6 +5,7 @@
 #include "duckdb/common/exception/binder_exception.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
 namespace duckdb {
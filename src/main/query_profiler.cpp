@@ -639,6 +639,8 @@ void QueryProfiler::Initialize(const PhysicalOperator &root_op) {
 	}
 	query_requires_profiling = false;
 	ClientConfig &config = ClientConfig::GetConfig(context);
+	// the plan of a running query is replaced when the query is re-optimized
+	tree_map.clear();
 	root = CreateTree(root_op, config.profiler_settings, 0);
 	if (!query_requires_profiling) {
 		// query does not require profiling: disable profiling for this query
@@ -0,0 +1,281 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+
+namespace duckdb {
+
+QueryResultCache::QueryResultCache(idx_t maximum_size_p) : maximum_size(maximum_size_p), size(0) {
+}
+
+QueryResultCache::~QueryResultCache() {
+}
+
+QueryResultCache &QueryResultCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetQueryResultCache();
+}
+
+QueryResultCache &QueryResultCache::Get(DatabaseInstance &db) {
+	return db.GetQueryResultCache();
+}
+
+void QueryResultCache::SetMaximumSize(idx_t maximum_size_p) {
+	lock_guard<mutex> guard(lock);
+	maximum_size = maximum_size_p;
+	EvictInternal();
+}
+
+idx_t QueryResultCache::GetSize() {
+	lock_guard<mutex> guard(lock);
+	return size;
+}
+
+static void WriteKeyString(MemoryStream &stream, const string &str) {
+	stream.Write<idx_t>(str.size());
+	stream.WriteData(const_data_ptr_cast(str.c_str()), str.size());
+}
+
+static bool IsCacheableExpression(unique_ptr<Expression> &expr) {
+	// the result of volatile functions (e.g. random()) or functions that are only consistent within a single query
+	// (e.g. now()) can differ between executions
+	if (expr->IsVolatile() || !expr->IsConsistent()) {
+		return false;
+	}
+	bool cacheable = true;
+	ExpressionIterator::EnumerateExpression(expr, [&](Expression &child) {
+		// bind data that cannot be serialized is not part of the fingerprint of the plan
+		if (child.GetExpressionClass() == ExpressionClass::BOUND_FUNCTION) {
+			auto &function = child.Cast<BoundFunctionExpression>();
+			if (function.bind_info && !function.function.serialize) {
+				cacheable = false;
+			}
+		} else if (child.GetExpressionClass() == ExpressionClass::BOUND_AGGREGATE) {
+			auto &aggregate = child.Cast<BoundAggregateExpression>();
+			if (aggregate.bind_info && !aggregate.function.serialize) {
+				cacheable = false;
+			}
+		}
+	});
+	return cacheable;
+}
+
+static bool IsCacheablePlan(LogicalOperator &op, vector<weak_ptr<DataTableInfo>> &tables) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		auto table = get.GetTable();
+		if (!table || !table->IsDuckTable()) {
+			// we can only track modifications of DuckDB tables - other table functions can read external data
+			return false;
+		}
+		tables.push_back(table->GetStorage().GetDataTableInfo());
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		return false;
+	default:
+		break;
+	}
+	bool cacheable = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *child) {
+		if (!IsCacheableExpression(*child)) {
+			cacheable = false;
+		}
+	});
+	if (!cacheable) {
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!IsCacheablePlan(*child, tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<QueryResultCacheInfo> QueryResultCache::CreateCacheInfo(ClientContext &context, LogicalOperator &plan,
+                                                                   const StatementProperties &properties) {
+	if (!properties.modified_databases.empty()) {
+		return nullptr;
+	}
+	auto result = make_uniq<QueryResultCacheInfo>();
+	if (!IsCacheablePlan(plan, result->tables)) {
+		return nullptr;
+	}
+	MemoryStream stream;
+	try {
+		BinarySerializer::Serialize(plan, stream);
+	} catch (NotImplementedException &ex) {
+		// not all operators support serialization
+		return nullptr;
+	}
+	// the plan is only valid for the catalog versions it was bound against
+	vector<string> databases;
+	for (auto &entry : properties.read_databases) {
+		databases.push_back(entry.first);
+	}
+	std::sort(databases.begin(), databases.end());
+	for (auto &name : databases) {
+		auto &identity = properties.read_databases.find(name)->second;
+		WriteKeyString(stream, name);
+		stream.Write<idx_t>(identity.catalog_oid);
+		stream.Write<idx_t>(identity.catalog_version.IsValid() ? identity.catalog_version.GetIndex()
+		                                                       : DConstants::INVALID_INDEX);
+	}
+	result->fingerprint = string(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	return result;
+}
+
+unique_ptr<QueryResultCacheKey> QueryResultCache::CreateCacheKey(ClientContext &context,
+                                                                 const PreparedStatementData &statement) {
+	D_ASSERT(statement.result_cache_info);
+	auto &info = *statement.result_cache_info;
+	auto result = make_uniq<QueryResultCacheKey>();
+	MemoryStream stream;
+	// the values of the parameters of the statement
+	vector<string> parameters;
+	for (auto &entry : statement.value_map) {
+		parameters.push_back(entry.first);
+	}
+	std::sort(parameters.begin(), parameters.end());
+	for (auto &name : parameters) {
+		WriteKeyString(stream, name);
+		BinarySerializer::Serialize(statement.value_map.find(name)->second->GetValue(), stream);
+	}
+	// settings (e.g. the TimeZone or the default null order) can influence the result
+	auto options_count = DBConfig::GetOptionCount();
+	for (idx_t option_idx = 0; option_idx < options_count; option_idx++) {
+		auto option = DBConfig::GetOptionByIndex(option_idx);
+		D_ASSERT(option);
+		BinarySerializer::Serialize(option->get_setting(context), stream);
+	}
+	auto &config = DBConfig::GetConfig(context);
+	vector<string> settings;
+	for (auto &entry : config.extension_parameters) {
+		settings.push_back(entry.first);
+	}
+	std::sort(settings.begin(), settings.end());
+	for (auto &name : settings) {
+		Value value;
+		context.TryGetCurrentSetting(name, value);
+		WriteKeyString(stream, name);
+		BinarySerializer::Serialize(value, stream);
+	}
+	// the versions of the tables
+	for (auto &table_ref : info.tables) {
+		auto table = table_ref.lock();
+		if (!table) {
+			return nullptr;
+		}
+		auto &transaction = DuckTransaction::Get(context, table->GetDB());
+		if (transaction.ChangesMade()) {
+			// the transaction can see its own uncommitted changes
+			return nullptr;
+		}
+		auto version = table->GetLastCommitId();
+		if (version >= transaction.start_time) {
+			// the table was modified after this transaction started - we do not see the latest version of the table
+			return nullptr;
+		}
+		stream.Write<transaction_t>(version);
+		result->tables.emplace_back(table_ref, version);
+	}
+	result->key = info.fingerprint;
+	result->key.append(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	return result;
+}
+
+shared_ptr<ColumnDataCollection> QueryResultCache::Lookup(const QueryResultCacheKey &key) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entry_map.find(key.key);
+	if (entry == entry_map.end()) {
+		return nullptr;
+	}
+	// move the entry to the front of the LRU list
+	entries.splice(entries.begin(), entries, entry->second);
+	return entry->second->result;
+}
+
+void QueryResultCache::Insert(ClientContext &context, const QueryResultCacheKey &key, ColumnDataCollection &result) {
+	if (result.AllocationSize() > maximum_size) {
+		return;
+	}
+	// copy the result into a collection that is managed by the buffer manager
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	auto cached_result = make_shared_ptr<ColumnDataCollection>(buffer_manager, result.Types());
+	ColumnDataAppendState append_state;
+	cached_result->InitializeAppend(append_state);
+	for (auto &chunk : result.Chunks()) {
+		cached_result->Append(append_state, chunk);
+	}
+	auto result_size = cached_result->AllocationSize();
+
+	lock_guard<mutex> guard(lock);
+	if (result_size > maximum_size || !IsValid(key.tables)) {
+		// a table was modified while we were executing the query
+		return;
+	}
+	auto existing = entry_map.find(key.key);
+	if (existing != entry_map.end()) {
+		EraseInternal(existing->second);
+	}
+	CacheEntry entry;
+	entry.key = key.key;
+	entry.tables = key.tables;
+	entry.result = std::move(cached_result);
+	entry.size = result_size;
+	entries.push_front(std::move(entry));
+	entry_map[key.key] = entries.begin();
+	size += result_size;
+	EvictInternal();
+}
+
+void QueryResultCache::Invalidate() {
+	lock_guard<mutex> guard(lock);
+	for (auto it = entries.begin(); it != entries.end();) {
+		auto current = it++;
+		if (!IsValid(current->tables)) {
+			EraseInternal(current);
+		}
+	}
+}
+
+bool QueryResultCache::IsValid(const vector<pair<weak_ptr<DataTableInfo>, transaction_t>> &tables) {
+	for (auto &entry : tables) {
+		auto table = entry.first.lock();
+		if (!table || table->GetLastCommitId() != entry.second) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void QueryResultCache::EvictInternal() {
+	while (size > maximum_size) {
+		D_ASSERT(!entries.empty());
+		EraseInternal(std::prev(entries.end()));
+	}
+}
+
+void QueryResultCache::EraseInternal(entry_iterator_t entry) {
+	D_ASSERT(size >= entry->size);
+	size -= entry->size;
+	entry_map.erase(entry->key);
+	entries.erase(entry);
+}
+
+} // namespace duckdb
@@ -9,10 +9,12 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -61,6 +63,26 @@ Value AccessModeSetting::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Adaptive Reoptimization Threshold
+//===--------------------------------------------------------------------===//
+void AdaptiveReoptimizationThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold != 0 && threshold < 1) {
+		throw InvalidInputException("adaptive_reoptimization_threshold must be 0 (disabled) or at least 1");
+	}
+	ClientConfig::GetConfig(context).adaptive_reoptimization_threshold = threshold;
+}
+
+void AdaptiveReoptimizationThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).adaptive_reoptimization_threshold =
+	    ClientConfig().adaptive_reoptimization_threshold;
+}
+
+Value AdaptiveReoptimizationThresholdSetting::GetSetting(const ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).adaptive_reoptimization_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Allow Persistent Secrets
 //===--------------------------------------------------------------------===//
@@ -1157,6 +1179,97 @@ Value MaximumMemorySetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.maximum_memory));
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto policy = StringUtil::Lower(input.ToString());
+	if (policy == "lru") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	} else if (policy == "2q") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException("Unrecognized option for buffer_eviction_policy, expected lru or 2q");
+	}
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.buffer_eviction_policy) {
+	case BufferEvictionPolicy::LRU:
+		return Value("lru");
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return Value("2q");
+	default:
+		throw InternalException("Unknown buffer eviction policy");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.query_memory_limit == DConstants::INVALID_INDEX) {
+		return Value("none");
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.query_memory_limit));
+}
+
+//===--------------------------------------------------------------------===//
+// Query Admission Control
+//===--------------------------------------------------------------------===//
+void QueryAdmissionControlSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.query_admission_control = input.GetValue<bool>();
+}
+
+void QueryAdmissionControlSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.query_admission_control = DBConfig().options.query_admission_control;
+}
+
+Value QueryAdmissionControlSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.query_admission_control);
+}
+
+//===--------------------------------------------------------------------===//
+// Query Admission Timeout
+//===--------------------------------------------------------------------===//
+void QueryAdmissionTimeoutSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto timeout = input.GetValue<int64_t>();
+	if (timeout < 0) {
+		throw InvalidInputException("query_admission_timeout cannot be negative");
+	}
+	ClientConfig::GetConfig(context).query_admission_timeout = NumericCast<idx_t>(timeout);
+}
+
+void QueryAdmissionTimeoutSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_admission_timeout = ClientConfig().query_admission_timeout;
+}
+
+Value QueryAdmissionTimeoutSetting::GetSetting(const ClientContext &context) {
+	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).query_admission_timeout));
+}
+
 //===--------------------------------------------------------------------===//
 // Streaming Buffer Size
 //===--------------------------------------------------------------------===//
@@ -1575,6 +1688,28 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Result Cache Size
+//===--------------------------------------------------------------------===//
+void QueryResultCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.query_result_cache_size = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		QueryResultCache::Get(*db).SetMaximumSize(config.options.query_result_cache_size);
+	}
+}
+
+void QueryResultCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.query_result_cache_size = DBConfig().options.query_result_cache_size;
+	if (db) {
+		QueryResultCache::Get(*db).SetMaximumSize(config.options.query_result_cache_size);
+	}
+}
+
+Value QueryResultCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.query_result_cache_size));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1659,6 +1794,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -11,6 +11,7 @@
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -588,29 +589,38 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &col
 
 			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
 			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
-				continue;
-			}
-
-			for (idx_t i = 1; i < func.children.size(); i++) {
-				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
-				D_ASSERT(!const_value_expr.value.IsNull());
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
-			}
-			if (in_values.empty()) {
-				continue;
-			}
-
-			sort(in_values.begin(), in_values.end());
-
-			bool can_simplify_in_clause = true;
-			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
-				if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
-					can_simplify_in_clause = false;
-					break;
+			bool can_simplify_in_clause = type.IsIntegral();
+			if (can_simplify_in_clause) {
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+					D_ASSERT(!const_value_expr.value.IsNull());
+					in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				}
+				sort(in_values.begin(), in_values.end());
+				for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
+					if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
+						can_simplify_in_clause = false;
+						break;
+					}
 				}
 			}
 			if (!can_simplify_in_clause) {
+				//! Small IN lists are pushed as a disjunction of equality filters, e.g. x IN (1, 10, 100) becomes
+				// x = 1 OR x = 10 OR x = 100. This allows scans to skip data using e.g. Bloom filters.
+				// Larger lists are rewritten into a join by the InClauseRewriter
+				if ((!type.IsNumeric() && type.id() != LogicalTypeId::VARCHAR) ||
+				    func.children.size() > MAX_IN_LIST_FILTER_SIZE + 1) {
+					continue;
+				}
+				auto or_filter = make_uniq<ConjunctionOrFilter>();
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+					or_filter->child_filters.push_back(
+					    make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, const_value_expr.value));
+				}
+				table_filters.PushFilter(column_index, std::move(or_filter));
+				table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+				remaining_filters.erase_at(rem_fil_idx);
 				continue;
 			}
 			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
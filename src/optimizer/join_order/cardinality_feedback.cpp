@@ -0,0 +1,62 @@
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+
+namespace duckdb {
+
+CardinalityFeedback &CardinalityFeedback::Get(ClientContext &context) {
+	return *ClientData::Get(context).cardinality_feedback;
+}
+
+void CardinalityFeedback::AddObservation(const vector<idx_t> &table_indexes, idx_t cardinality) {
+	lock_guard<mutex> guard(lock);
+	observations[table_indexes] = cardinality;
+}
+
+optional_idx CardinalityFeedback::GetObservation(const vector<idx_t> &table_indexes) {
+	lock_guard<mutex> guard(lock);
+	auto entry = observations.find(table_indexes);
+	if (entry == observations.end()) {
+		return optional_idx();
+	}
+	return entry->second;
+}
+
+map<vector<idx_t>, idx_t> CardinalityFeedback::GetObservations() {
+	lock_guard<mutex> guard(lock);
+	return observations;
+}
+
+bool CardinalityFeedback::HasObservations() {
+	lock_guard<mutex> guard(lock);
+	return !observations.empty();
+}
+
+void CardinalityFeedback::Clear() {
+	lock_guard<mutex> guard(lock);
+	observations.clear();
+}
+
+static void GetTableIndexesRecursive(LogicalOperator &op, vector<idx_t> &result) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		result.push_back(op.Cast<LogicalGet>().table_index);
+	}
+	for (auto &child : op.children) {
+		if (!child) {
+			// the physical planner has already moved the input of table in-out functions out of the plan
+			continue;
+		}
+		GetTableIndexesRecursive(*child, result);
+	}
+}
+
+vector<idx_t> CardinalityFeedback::GetTableIndexes(LogicalOperator &op) {
+	vector<idx_t> result;
+	GetTableIndexesRecursive(op, result);
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/optimizer/join_order/plan_enumerator.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/query_graph_manager.hpp"
 
@@ -464,6 +465,30 @@ void PlanEnumerator::InitLeafPlans() {
 		plans[relation_set] = std::move(join_node);
 		cost_model.cardinality_estimator.InitCardinalityEstimatorProps(&relation_set, stats);
 	}
+
+	// use the cardinalities of joins that were observed while executing the query before it was re-optimized
+	auto &feedback = CardinalityFeedback::Get(query_graph_manager.context);
+	if (!feedback.HasObservations()) {
+		return;
+	}
+	auto &relation_mapping = query_graph_manager.relation_manager.relation_mapping;
+	for (auto &observation : feedback.GetObservations()) {
+		auto &table_indexes = observation.first;
+		unordered_set<idx_t> relations;
+		for (auto &table_index : table_indexes) {
+			auto entry = relation_mapping.find(table_index);
+			if (entry == relation_mapping.end()) {
+				break;
+			}
+			relations.insert(entry->second);
+		}
+		// the observation can only be used if every table is a separate relation of this join order problem
+		if (relations.size() < 2 || relations.size() != table_indexes.size()) {
+			continue;
+		}
+		auto &relation_set = query_graph_manager.set_manager.GetJoinRelation(relations);
+		cost_model.cardinality_estimator.SetObservedCardinality(relation_set, double(observation.second));
+	}
 }
 
 // the plan enumeration is a straight implementation of the paper "Dynamic Programming Strikes Back" by Guido
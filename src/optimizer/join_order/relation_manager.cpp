@@ -2,6 +2,7 @@
 
 #include "duckdb/common/enums/join_type.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/optimizer/join_order/relation_statistics_helper.hpp"
 #include "duckdb/parser/expression_map.hpp"
@@ -27,8 +28,31 @@ idx_t RelationManager::NumRelations() {
 	return relations.size();
 }
 
+//! Replaces the estimated cardinality of the relation with the cardinality that was observed while executing the query
+//! before it was re-optimized (if any)
+static RelationStats ApplyCardinalityFeedback(ClientContext &context, LogicalOperator &op, const RelationStats &stats) {
+	auto &feedback = CardinalityFeedback::Get(context);
+	if (!feedback.HasObservations()) {
+		return stats;
+	}
+	auto observed_cardinality = feedback.GetObservation(CardinalityFeedback::GetTableIndexes(op));
+	if (!observed_cardinality.IsValid()) {
+		return stats;
+	}
+	auto result = stats;
+	result.cardinality = observed_cardinality.GetIndex();
+	for (auto &distinct_count : result.column_distinct_count) {
+		// a relation cannot have more distinct values than rows
+		if (!distinct_count.from_hll || distinct_count.distinct_count > result.cardinality) {
+			distinct_count.distinct_count = MaxValue<idx_t>(result.cardinality, 1);
+		}
+	}
+	return result;
+}
+
 void RelationManager::AddAggregateOrWindowRelation(LogicalOperator &op, optional_ptr<LogicalOperator> parent,
-                                                   const RelationStats &stats, LogicalOperatorType op_type) {
+                                                   const RelationStats &input_stats, LogicalOperatorType op_type) {
+	auto stats = ApplyCardinalityFeedback(context, op, input_stats);
 	auto relation = make_uniq<SingleJoinRelation>(op, parent, stats);
 	auto relation_id = relations.size();
 
@@ -44,11 +68,12 @@ void RelationManager::AddAggregateOrWindowRelation(LogicalOperator &op, optional
 }
 
 void RelationManager::AddRelation(LogicalOperator &op, optional_ptr<LogicalOperator> parent,
-                                  const RelationStats &stats) {
+                                  const RelationStats &input_stats) {
 
 	// if parent is null, then this is a root relation
 	// if parent is not null, it should have multiple children
 	D_ASSERT(!parent || parent->children.size() >= 2);
+	auto stats = ApplyCardinalityFeedback(context, op, input_stats);
 	auto relation = make_uniq<SingleJoinRelation>(op, parent, stats);
 	auto relation_id = relations.size();
 
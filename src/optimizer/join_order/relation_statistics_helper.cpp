@@ -8,6 +8,7 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
 
 namespace duckdb {
 
@@ -52,6 +53,22 @@ static ExpressionBinding GetChildColumnBinding(Expression &expr) {
 	return ret;
 }
 
+static unique_ptr<HistogramStatistics> GetHistogramStatistics(optional_ptr<TableCatalogEntry> table,
+                                                              column_t column_id) {
+	if (!table || !table->IsDuckTable() || column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	auto &columns = table->GetColumns();
+	if (column_id >= columns.LogicalColumnCount()) {
+		return nullptr;
+	}
+	auto &column = columns.GetColumn(LogicalIndex(column_id));
+	if (column.Generated()) {
+		return nullptr;
+	}
+	return table->GetStorage().GetHistogram(column.StorageOid());
+}
+
 RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientContext &context) {
 	auto return_stats = RelationStats();
 
@@ -84,6 +101,11 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 			column_statistics = get.function.statistics(context, get.bind_data.get(), column_ids[i]);
 			if (column_statistics && have_catalog_table_statistics) {
 				auto distinct_count = MaxValue((idx_t)1, column_statistics->GetDistinctCount());
+				// skewed columns produce bigger joins than their distinct count suggests
+				auto histogram = GetHistogramStatistics(catalog_table, column_ids[i]);
+				if (histogram) {
+					distinct_count = histogram->EstimateJoinDistinctCount(distinct_count);
+				}
 				auto column_distinct_count = DistinctCount({distinct_count, true});
 				return_stats.column_distinct_count.push_back(column_distinct_count);
 				return_stats.column_names.push_back(name + "." + get.names.at(column_ids.at(i)));
@@ -106,11 +128,25 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 
 	if (!get.table_filters.filters.empty()) {
 		column_statistics = nullptr;
+		// the selectivity of the filters that could be estimated using histograms
+		bool has_histogram_estimate = false;
+		double histogram_selectivity = 1;
 		for (auto &it : get.table_filters.filters) {
 			if (get.bind_data && get.function.statistics) {
 				column_statistics = get.function.statistics(context, get.bind_data.get(), it.first);
 			}
 
+			auto histogram = column_statistics ? GetHistogramStatistics(catalog_table, it.first) : nullptr;
+			if (histogram) {
+				double selectivity;
+				auto distinct_count = MaxValue<idx_t>(1, column_statistics->GetDistinctCount());
+				if (EstimateSelectivity(*it.second, *histogram, distinct_count, selectivity)) {
+					// filters on different columns are assumed to be independent
+					histogram_selectivity *= selectivity;
+					has_histogram_estimate = true;
+					continue;
+				}
+			}
 			if (column_statistics && it.second->filter_type == TableFilterType::CONJUNCTION_AND) {
 				auto &filter = it.second->Cast<ConjunctionAndFilter>();
 				idx_t cardinality_with_and_filter = RelationStatisticsHelper::InspectConjunctionAND(
@@ -120,8 +156,13 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 		}
 		// if the above code didn't find an equality filter (i.e country_code = "[us]")
 		// and there are other table filters (i.e cost > 50), use default selectivity.
+		if (has_histogram_estimate) {
+			auto cardinality_with_histogram =
+			    MaxValue<idx_t>(LossyNumericCast<idx_t>(double(base_table_cardinality) * histogram_selectivity), 1U);
+			cardinality_after_filters = MinValue(cardinality_after_filters, cardinality_with_histogram);
+		}
 		bool has_equality_filter = (cardinality_after_filters != base_table_cardinality);
-		if (!has_equality_filter && !get.table_filters.filters.empty()) {
+		if (!has_equality_filter && !has_histogram_estimate && !get.table_filters.filters.empty()) {
 			cardinality_after_filters = MaxValue<idx_t>(
 			    LossyNumericCast<idx_t>(double(base_table_cardinality) * RelationStatisticsHelper::DEFAULT_SELECTIVITY),
 			    1U);
@@ -392,6 +433,82 @@ idx_t RelationStatisticsHelper::InspectConjunctionAND(idx_t cardinality, idx_t c
 	return cardinality_after_filters;
 }
 
+bool RelationStatisticsHelper::EstimateSelectivity(TableFilter &filter, HistogramStatistics &histogram,
+                                                   idx_t distinct_count, double &selectivity) {
+	vector<reference<TableFilter>> child_filters;
+	if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			child_filters.push_back(*child_filter);
+		}
+	} else {
+		child_filters.push_back(filter);
+	}
+
+	// collect the tightest bounds of the filters
+	bool has_estimate = false;
+	bool has_equality = false;
+	double equality_selectivity = 1;
+	Value lower, upper;
+	bool lower_inclusive = false, upper_inclusive = false;
+	for (auto &child_ref : child_filters) {
+		auto &child_filter = child_ref.get();
+		if (child_filter.filter_type == TableFilterType::IS_NOT_NULL) {
+			has_estimate = true;
+			continue;
+		}
+		if (child_filter.filter_type != TableFilterType::CONSTANT_COMPARISON) {
+			continue;
+		}
+		auto &comparison_filter = child_filter.Cast<ConstantFilter>();
+		auto &constant = comparison_filter.constant;
+		if (!histogram.CanEstimate(constant)) {
+			continue;
+		}
+		switch (comparison_filter.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			equality_selectivity =
+			    MinValue(equality_selectivity, histogram.EstimateEquality(constant, distinct_count));
+			has_equality = true;
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO: {
+			bool inclusive = comparison_filter.comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+			if (lower.IsNull() || constant > lower || (constant == lower && !inclusive)) {
+				lower = constant;
+				lower_inclusive = inclusive;
+			}
+			break;
+		}
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO: {
+			bool inclusive = comparison_filter.comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+			if (upper.IsNull() || constant < upper || (constant == upper && !inclusive)) {
+				upper = constant;
+				upper_inclusive = inclusive;
+			}
+			break;
+		}
+		default:
+			continue;
+		}
+		has_estimate = true;
+	}
+	if (!has_estimate) {
+		return false;
+	}
+	if (has_equality) {
+		selectivity = equality_selectivity;
+		return true;
+	}
+	// the fraction of rows that is below the upper bound and not below the lower bound
+	double result = upper.IsNull() ? histogram.NonNullFraction() : histogram.EstimateLessThan(upper, upper_inclusive);
+	if (!lower.IsNull()) {
+		result -= histogram.EstimateLessThan(lower, !lower_inclusive);
+	}
+	selectivity = MaxValue<double>(0, MinValue<double>(1, result));
+	return true;
+}
+
 // TODO: Currently only simple AND filters are pushed into table scans.
 //  When OR filters are pushed this function can be added
 // idx_t RelationStatisticsHelper::InspectConjunctionOR(idx_t cardinality, idx_t column_index, ConjunctionOrFilter
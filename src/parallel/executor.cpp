@@ -7,6 +7,7 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline_complete_event.hpp"
 #include "duckdb/parallel/pipeline_event.hpp"
@@ -22,7 +23,8 @@
 
 namespace duckdb {
 
-Executor::Executor(ClientContext &context) : context(context), executor_tasks(0) {
+Executor::Executor(ClientContext &context)
+    : context(context), executor_tasks(0), reoptimization_threshold(0), requires_reoptimization(false) {
 }
 
 Executor::~Executor() {
@@ -536,6 +538,24 @@ bool Executor::ExecutionIsFinished() {
 	return completed_pipelines >= total_pipelines || HasError();
 }
 
+void Executor::EnableReoptimization(double threshold) {
+	reoptimization_threshold = threshold;
+}
+
+void Executor::ReportCardinality(const vector<idx_t> &table_indexes, idx_t estimated_cardinality, idx_t cardinality) {
+	if (reoptimization_threshold <= 0 || table_indexes.empty()) {
+		return;
+	}
+	auto estimate = static_cast<double>(MaxValue<idx_t>(estimated_cardinality, 1));
+	auto actual = static_cast<double>(MaxValue<idx_t>(cardinality, 1));
+	if (MaxValue(estimate, actual) / MinValue(estimate, actual) <= reoptimization_threshold) {
+		return;
+	}
+	// the estimate is off: the join order of the query was chosen using a wrong cardinality
+	CardinalityFeedback::Get(context).AddObservation(table_indexes, cardinality);
+	requires_reoptimization = true;
+}
+
 PendingExecutionResult Executor::ExecuteTask(bool dry_run) {
 	// Only executor should return NO_TASKS_AVAILABLE
 	D_ASSERT(execution_result != PendingExecutionResult::NO_TASKS_AVAILABLE);
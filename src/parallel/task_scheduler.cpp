@@ -11,6 +11,7 @@
 #include "duckdb/common/thread.hpp"
 #include "lightweightsemaphore.h"
 
+#include <deque>
 #include <thread>
 #else
 #include <queue>
@@ -35,36 +36,201 @@ struct SchedulerThread {
 };
 
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+struct QueuedTask;
+
+//! The queue of the tasks of a single producer. It is shared by the ProducerToken and the tasks of the producer, so
+//! that it remains valid while tasks of a destroyed producer are still queued.
+struct ProducerQueue {
+	ProducerQueue() : queued_tasks(0) {
+	}
+
+	mutex lock;
+	//! The tasks of this producer in the order in which they were scheduled. Tasks that have been taken from a
+	//! TaskDeque are removed lazily.
+	std::deque<shared_ptr<QueuedTask>> tasks;
+	//! The number of tasks of this producer that are currently queued
+	atomic<idx_t> queued_tasks;
+};
+
+struct QueueProducerToken {
+	explicit QueueProducerToken(ConcurrentQueue &queue) : producer(make_shared_ptr<ProducerQueue>()) {
+	}
+	~QueueProducerToken() {
+		// the queued tasks refer back to the producer queue - clear it to break the cycle
+		lock_guard<mutex> guard(producer->lock);
+		producer->tasks.clear();
+	}
+
+	shared_ptr<ProducerQueue> producer;
+};
+
+//! A task together with the producer that scheduled it. The task is queued both in a TaskDeque and in the queue of
+//! its producer, and is executed by whoever takes it first.
+struct QueuedTask {
+	QueuedTask(shared_ptr<ProducerQueue> producer_p, shared_ptr<Task> task_p)
+	    : producer(std::move(producer_p)), task(std::move(task_p)), taken(false) {
+	}
+
+	shared_ptr<ProducerQueue> producer;
+	shared_ptr<Task> task;
+	atomic<bool> taken;
+
+	//! Takes the task - returns false if it has already been taken
+	bool TryTake(shared_ptr<Task> &result) {
+		if (taken.exchange(true)) {
+			return false;
+		}
+		producer->queued_tasks--;
+		result = std::move(task);
+		return true;
+	}
+};
+
+//! The TaskDeque holds the tasks scheduled by threads running on a specific CPU. Threads on that CPU push and pop
+//! at the back (LIFO), so a task is likely executed on the core that scheduled it, while its inputs are still in
+//! cache. Threads on other CPUs steal from the front (FIFO), taking the oldest (coldest) tasks.
+struct TaskDeque {
+	TaskDeque() : size(0) {
+	}
+
+	mutex lock;
+	std::deque<shared_ptr<QueuedTask>> tasks;
+	//! The number of tasks in the deque - can be read without holding the lock
+	atomic<idx_t> size;
+
+	void Push(shared_ptr<QueuedTask> task) {
+		lock_guard<mutex> guard(lock);
+		tasks.push_back(std::move(task));
+		size = tasks.size();
+	}
+	bool Pop(shared_ptr<Task> &task, bool steal) {
+		if (size.load(std::memory_order_relaxed) == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		while (!tasks.empty()) {
+			shared_ptr<QueuedTask> entry;
+			if (steal) {
+				entry = std::move(tasks.front());
+				tasks.pop_front();
+			} else {
+				entry = std::move(tasks.back());
+				tasks.pop_back();
+			}
+			size = tasks.size();
+			// skip the tasks that have already been taken from the queue of their producer
+			if (entry->TryTake(task)) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+//! The ConcurrentQueue distributes tasks over a TaskDeque per CPU. Threads first look for work in the deque of the
+//! CPU they run on, and then steal from the other deques - starting with the CPUs that are close to theirs (these
+//! are likely to share a cache or NUMA node), and then from random victims.
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	//! The number of adjacent CPUs we prefer to steal from
+	static constexpr const idx_t CPU_GROUP_SIZE = 8;
+	//! The maximum number of deques
+	static constexpr const idx_t MAXIMUM_DEQUE_COUNT = 1024;
+
+	ConcurrentQueue();
+
 	lightweight_semaphore_t semaphore;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
-};
+	bool Dequeue(shared_ptr<Task> &task);
 
-struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+private:
+	TaskDeque &GetLocalDeque() {
+		return deques[TaskScheduler::GetEstimatedCPUId() & deque_mask];
+	}
+	idx_t NextRandom() {
+		// a (racy) xorshift - we only need a cheap source of different victims
+		auto x = random_state.load(std::memory_order_relaxed);
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		random_state.store(x, std::memory_order_relaxed);
+		return x;
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+private:
+	unique_array<TaskDeque> deques;
+	idx_t deque_count;
+	idx_t deque_mask;
+	atomic<idx_t> random_state;
 };
 
+ConcurrentQueue::ConcurrentQueue() : random_state(0x9E3779B97F4A7C15ULL) {
+	auto cpu_count = MaxValue<idx_t>(std::thread::hardware_concurrency(), 1);
+	deque_count = MinValue<idx_t>(NextPowerOfTwo(cpu_count), MAXIMUM_DEQUE_COUNT);
+	deque_mask = deque_count - 1;
+	deques = make_uniq_array<TaskDeque>(deque_count);
+}
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
-		semaphore.signal();
-	} else {
-		throw InternalException("Could not schedule task!");
+	auto &producer = token.token->producer;
+	auto entry = make_shared_ptr<QueuedTask>(producer, std::move(task));
+	producer->queued_tasks++;
+	{
+		lock_guard<mutex> guard(producer->lock);
+		// drop the tasks at the front that have already been taken from a TaskDeque
+		while (!producer->tasks.empty() && producer->tasks.front()->taken.load(std::memory_order_relaxed)) {
+			producer->tasks.pop_front();
+		}
+		producer->tasks.push_back(entry);
 	}
+	GetLocalDeque().Push(std::move(entry));
+	semaphore.signal();
 }
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	auto &producer = *token.token->producer;
+	if (producer.queued_tasks.load() == 0) {
+		return false;
+	}
+	lock_guard<mutex> guard(producer.lock);
+	// the tasks of a single producer are returned in the order in which they were scheduled
+	while (!producer.tasks.empty()) {
+		auto entry = std::move(producer.tasks.front());
+		producer.tasks.pop_front();
+		if (entry->TryTake(task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task) {
+	auto local = TaskScheduler::GetEstimatedCPUId() & deque_mask;
+	if (deques[local].Pop(task, false)) {
+		return true;
+	}
+	// steal from the CPUs in our group first
+	auto group_size = MinValue<idx_t>(CPU_GROUP_SIZE, deque_count);
+	auto group_start = local & ~(group_size - 1);
+	auto offset = NextRandom();
+	for (idx_t i = 0; i < group_size; i++) {
+		auto victim = group_start + ((offset + i) & (group_size - 1));
+		if (victim != local && deques[victim].Pop(task, true)) {
+			return true;
+		}
+	}
+	// then from random victims
+	offset = NextRandom();
+	for (idx_t i = 0; i < deque_count; i++) {
+		auto victim = (offset + i) & deque_mask;
+		if (victim != local && deques[victim].Pop(task, true)) {
+			return true;
+		}
+	}
+	return false;
 }
 
 #else
@@ -164,7 +330,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				queue->semaphore.wait();
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->Dequeue(task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -197,7 +363,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -227,7 +393,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task)) {
 			return;
 		}
 		try {
@@ -124,6 +124,32 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 		throw ParserException("Table must have at least one column!");
 	}
 
+	if (stmt.options) {
+		for (auto cell = stmt.options->head; cell != nullptr; cell = lnext(cell)) {
+			auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+			auto option_name = StringUtil::Lower(def_elem->defname);
+			if (option_name != "order_by" && option_name != "cluster_by") {
+				continue;
+			}
+			// the sort keys are given as a comma-separated list of column names, e.g. WITH (order_by = 'a, b')
+			if (!def_elem->arg || def_elem->arg->type != duckdb_libpgquery::T_PGString) {
+				throw ParserException("Option \"%s\" expects a comma-separated list of column names as a string",
+				                      option_name);
+			}
+			if (!info->sort_keys.empty()) {
+				throw ParserException("The sort keys of a table can only be specified once");
+			}
+			auto value = PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg);
+			for (auto &key : StringUtil::Split(value->val.str, ',')) {
+				StringUtil::Trim(key);
+				if (key.empty()) {
+					throw ParserException("Option \"%s\" contains an empty column name", option_name);
+				}
+				info->sort_keys.push_back(std::move(key));
+			}
+		}
+	}
+
 	result->info = std::move(info);
 	return result;
 }
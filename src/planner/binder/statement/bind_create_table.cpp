@@ -351,6 +351,21 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 		}
 		BindLogicalType(column.TypeMutable(), &result->schema.catalog, result->schema.name);
 	}
+	// verify that the sort keys refer to distinct, physical columns
+	case_insensitive_set_t sort_key_names;
+	for (auto &sort_key : base.sort_keys) {
+		if (!base.columns.ColumnExists(sort_key)) {
+			throw BinderException("Column \"%s\" in ORDER_BY not found in table \"%s\"", sort_key, base.table);
+		}
+		auto &column = base.columns.GetColumn(sort_key);
+		if (column.Generated()) {
+			throw BinderException("Generated column \"%s\" cannot be used as a sort key", column.Name());
+		}
+		if (!sort_key_names.insert(column.Name()).second) {
+			throw BinderException("Column \"%s\" is specified as a sort key more than once", column.Name());
+		}
+		sort_key = column.Name();
+	}
 	result->dependencies.VerifyDependencies(schema.catalog, result->Base().table);
 
 	auto &properties = GetStatementProperties();
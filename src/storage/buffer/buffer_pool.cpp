@@ -194,9 +194,11 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
     : maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()), eviction_policy(BufferEvictionPolicy::LRU),
+      protected_memory(0) {
+	// one queue per buffer type, plus the protected queue of re-used blocks
+	queues.reserve(FILE_BUFFER_TYPE_COUNT + 1);
+	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT + 1; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
 }
@@ -204,7 +206,8 @@ BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
+	auto queue_idx = GetEvictionQueueIndex(*handle);
+	auto &queue = *queues[queue_idx];
 
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
@@ -219,8 +222,10 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		// the previous version is not necessarily in the same queue, if the block was moved to the protected queue
+		queues[handle->eviction_queue_idx]->IncrementDeadNodes();
 	}
+	handle->eviction_queue_idx = queue_idx;
 
 	// Get the eviction queue for the buffer type and add it
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
@@ -230,8 +235,57 @@ EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
 	return *queues[uint8_t(type) - 1];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+uint8_t BufferPool::GetEvictionQueueIndex(const BlockHandle &handle) const {
+	if (handle.frequently_used) {
+		return PROTECTED_QUEUE_INDEX;
+	}
+	return uint8_t(handle.buffer->type) - 1;
+}
+
+void BufferPool::IncrementDeadNodes(const BlockHandle &handle) {
+	queues[handle.eviction_queue_idx]->IncrementDeadNodes();
+}
+
+void BufferPool::RegisterPin(BlockHandle &handle, bool loaded) {
+	if (!loaded || handle.prefetched) {
+		// the block had to be read - either now, or by a prefetch for this pin
+		handle.prefetched = false;
+		pin_statistics.RegisterPin(handle.tag, false);
+		return;
+	}
+	pin_statistics.RegisterPin(handle.tag, true);
+	if (eviction_policy != BufferEvictionPolicy::TWO_QUEUE || handle.frequently_used ||
+	    handle.buffer->type != FileBufferType::BLOCK || handle.readers > 0) {
+		// concurrent pins of the same block (e.g., by the threads of a scan) do not count as re-use
+		return;
+	}
+	// the block is used again while it is in memory: it is moved to the protected queue when it is unpinned
+	handle.frequently_used = true;
+	protected_memory += handle.memory_usage;
+}
+
+void BufferPool::UnprotectBlock(BlockHandle &handle) {
+	if (!handle.frequently_used) {
+		return;
+	}
+	handle.frequently_used = false;
+	protected_memory -= handle.memory_usage;
+}
+
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
+idx_t BufferPool::GetBufferHits(MemoryTag tag) const {
+	return pin_statistics.GetCount(pin_statistics.hits, tag);
+}
+
+idx_t BufferPool::GetBufferMisses(MemoryTag tag) const {
+	return pin_statistics.GetCount(pin_statistics.misses, tag);
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -256,6 +310,14 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
+	if (protected_memory > static_cast<idx_t>(static_cast<double>(memory_limit) * PROTECTED_MEMORY_RATIO)) {
+		// the re-used persistent table data exceeds its share of the memory: evict the least recently used first
+		auto protected_result = EvictProtectedBlocks(tag, extra_memory, memory_limit, buffer);
+		if (protected_result.success) {
+			return protected_result;
+		}
+	}
+
 	// First, we try to evict persistent table data
 	auto block_result =
 	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
@@ -263,6 +325,13 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 		return block_result;
 	}
 
+	// Then, we try to evict persistent table data that was re-used while it was in memory (2Q policy)
+	auto protected_result =
+	    EvictBlocksInternal(*queues[PROTECTED_QUEUE_INDEX], tag, extra_memory, memory_limit, buffer);
+	if (protected_result.success) {
+		return protected_result;
+	}
+
 	// If that does not succeed, we try to evict temporary data
 	auto managed_buffer_result = EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::MANAGED_BUFFER), tag,
 	                                                 extra_memory, memory_limit, buffer);
@@ -312,6 +381,44 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 	return {found, std::move(r)};
 }
 
+BufferPool::EvictionResult BufferPool::EvictProtectedBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
+                                                            unique_ptr<FileBuffer> *buffer) {
+	TempBufferPoolReservation r(tag, *this, extra_memory);
+	bool found = false;
+
+	if (memory_usage.GetUsedMemory(MemoryUsageCaches::NO_FLUSH) <= memory_limit) {
+		return {true, std::move(r)};
+	}
+
+	auto protected_limit = static_cast<idx_t>(static_cast<double>(memory_limit) * PROTECTED_MEMORY_RATIO);
+	queues[PROTECTED_QUEUE_INDEX]->IterateUnloadableBlocks(
+	    [&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
+		    if (buffer && handle->buffer->AllocSize() == extra_memory) {
+			    // we can re-use the memory directly
+			    *buffer = handle->UnloadAndTakeBlock();
+			    found = true;
+			    return false;
+		    }
+
+		    // release the memory and mark the block as unloaded
+		    handle->Unload();
+
+		    if (memory_usage.GetUsedMemory(MemoryUsageCaches::NO_FLUSH) <= memory_limit) {
+			    found = true;
+			    return false;
+		    }
+
+		    // continue until the protected blocks are back within their share of the memory
+		    return protected_memory > protected_limit;
+	    });
+
+	if (!found) {
+		r.Resize(0);
+	}
+
+	return {found, std::move(r)};
+}
+
 idx_t BufferPool::PurgeAgedBlocks(uint32_t max_age_sec) {
 	int64_t now = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now())
 	                  .time_since_epoch()
@@ -373,6 +480,10 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 
 void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
+	if (type == FileBufferType::BLOCK) {
+		// blocks are also added to the protected queue
+		queues[PROTECTED_QUEUE_INDEX]->Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
@@ -435,4 +546,32 @@ void BufferPool::MemoryUsage::UpdateUsedMemory(MemoryTag tag, int64_t size) {
 	}
 }
 
+BufferPool::PinStatistics::PinStatistics() {
+	for (auto &cache : hits) {
+		for (auto &v : cache) {
+			v = 0;
+		}
+	}
+	for (auto &cache : misses) {
+		for (auto &v : cache) {
+			v = 0;
+		}
+	}
+}
+
+void BufferPool::PinStatistics::RegisterPin(MemoryTag tag, bool hit) {
+	auto cache_idx = (idx_t)TaskScheduler::GetEstimatedCPUId() % PIN_STATISTICS_CACHE_COUNT;
+	auto &counters = hit ? hits[cache_idx] : misses[cache_idx];
+	counters[(idx_t)tag].fetch_add(1, std::memory_order_relaxed);
+}
+
+idx_t BufferPool::PinStatistics::GetCount(const array<PinCounters, PIN_STATISTICS_CACHE_COUNT> &counters,
+                                          MemoryTag tag) const {
+	idx_t count = 0;
+	for (auto &cache : counters) {
+		count += cache[(idx_t)tag].load(std::memory_order_relaxed);
+	}
+	return count;
+}
+
 } // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table/table_statistics.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -54,7 +55,11 @@ void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stat
 	auto pointer = table_data_writer.GetMetaBlockPointer();
 
 	// Serialize statistics as a single unit
-	BinarySerializer stats_serializer(table_data_writer);
+	// newer statistics (e.g. histograms) are only written when the storage compatibility version allows it
+	auto &config = DBConfig::Get(info->GetDB());
+	SerializationOptions serialization_options;
+	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
+	BinarySerializer stats_serializer(table_data_writer, serialization_options);
 	stats_serializer.Begin();
 	global_stats.Serialize(stats_serializer);
 	stats_serializer.End();
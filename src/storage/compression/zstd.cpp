@@ -0,0 +1,558 @@
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a header, the metadata of every frame, and the compressed frames.
+// A frame holds the lengths followed by the data of a run of consecutive strings, and is compressed on its own,
+// so that a scan or fetch only has to decompress the frames that contain the rows it needs.
+//
+// | header | frame metadata 0 .. n | ... | frame n | ... | frame 0 |
+//
+// While compressing, the frames are written back-to-front from the end of the block. When the segment is flushed,
+// the frames are moved to directly after the metadata if this saves enough space (similar to the dictionary).
+typedef struct {
+	uint32_t frame_count;
+} zstd_compression_header_t;
+
+typedef struct {
+	//! The row of the first string in the frame, relative to the start of the segment
+	uint32_t row_start;
+	//! The offset of the compressed frame, relative to the start of the segment
+	uint32_t offset;
+	//! The size of the compressed frame
+	uint32_t compressed_size;
+	//! The size of the decompressed frame (string lengths and string data)
+	uint32_t uncompressed_size;
+} zstd_frame_metadata_t;
+
+struct ZSTDStorage {
+	//! ZSTD decompression is slower than the lightweight string compression methods, so it needs to compress better
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 1.5;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+	static constexpr int COMPRESSION_LEVEL = 3;
+	//! The maximum number of strings in a single frame
+	static constexpr idx_t FRAME_ROW_COUNT = STANDARD_VECTOR_SIZE;
+
+	//! A frame is closed once its uncompressed size exceeds a quarter of the block
+	static idx_t GetFrameTargetSize(idx_t block_size) {
+		return block_size / 4;
+	}
+	//! Strings larger than half a block are not supported - this guarantees that every frame fits in a block
+	static idx_t GetStringLimit(idx_t block_size) {
+		return block_size / 2;
+	}
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	static idx_t GetFrameCount(data_ptr_t base_ptr);
+	static zstd_frame_metadata_t GetFrameMetadata(data_ptr_t base_ptr, idx_t frame_idx);
+	//! Returns the index of the frame that contains the given row
+	static idx_t FindFrame(data_ptr_t base_ptr, idx_t row);
+	//! Decompresses a frame into "target", which must hold at least "frame.uncompressed_size" bytes
+	static void DecompressFrame(duckdb_zstd::ZSTD_DCtx *context, data_ptr_t base_ptr,
+	                            const zstd_frame_metadata_t &frame, data_ptr_t target);
+};
+
+//===--------------------------------------------------------------------===//
+// Frame Builder
+//===--------------------------------------------------------------------===//
+//! Collects the strings of a single frame before it is compressed
+struct ZSTDFrameBuilder {
+	explicit ZSTDFrameBuilder(idx_t block_size) : target_size(ZSTDStorage::GetFrameTargetSize(block_size)) {
+	}
+
+	void Append(const string_t &str) {
+		auto size = str.GetSize();
+		lengths.push_back(NumericCast<uint32_t>(size));
+		string_data.insert(string_data.end(), const_data_ptr_cast(str.GetData()),
+		                   const_data_ptr_cast(str.GetData()) + size);
+	}
+	void AppendNull() {
+		lengths.push_back(0);
+	}
+
+	idx_t RowCount() const {
+		return lengths.size();
+	}
+	idx_t UncompressedSize() const {
+		return lengths.size() * sizeof(uint32_t) + string_data.size();
+	}
+	bool IsFull() const {
+		return RowCount() >= ZSTDStorage::FRAME_ROW_COUNT || UncompressedSize() >= target_size;
+	}
+
+	//! Compresses the frame into "target", and returns the compressed size
+	idx_t Compress(duckdb_zstd::ZSTD_CCtx *context, vector<data_t> &target) {
+		auto uncompressed_size = UncompressedSize();
+		uncompressed.resize(uncompressed_size);
+		auto lengths_size = lengths.size() * sizeof(uint32_t);
+		if (lengths_size > 0) {
+			memcpy(uncompressed.data(), lengths.data(), lengths_size);
+		}
+		if (!string_data.empty()) {
+			memcpy(uncompressed.data() + lengths_size, string_data.data(), string_data.size());
+		}
+		target.resize(duckdb_zstd::ZSTD_compressBound(uncompressed_size));
+		auto compressed_size = duckdb_zstd::ZSTD_compressCCtx(context, target.data(), target.size(),
+		                                                       uncompressed.data(), uncompressed_size,
+		                                                       ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		return compressed_size;
+	}
+
+	void Reset() {
+		lengths.clear();
+		string_data.clear();
+	}
+
+	idx_t target_size;
+	vector<uint32_t> lengths;
+	vector<data_t> string_data;
+	//! Buffer used to lay out the frame before compressing it
+	vector<data_t> uncompressed;
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	explicit ZSTDAnalyzeState(const CompressionInfo &info)
+	    : AnalyzeState(info), frame(info.GetBlockSize()), context(duckdb_zstd::ZSTD_createCCtx()) {
+	}
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CompressFrame() {
+		if (frame.RowCount() == 0) {
+			return;
+		}
+		compressed_size += frame.Compress(context, compressed_buffer);
+		frame_count++;
+		frame.Reset();
+	}
+
+	//! The total amount of rows
+	idx_t count = 0;
+	//! The amount of rows we have compressed to estimate the size
+	idx_t sampled_count = 0;
+	//! The compressed size of the sampled frames
+	idx_t compressed_size = 0;
+	//! The amount of sampled frames
+	idx_t frame_count = 0;
+
+	ZSTDFrameBuilder frame;
+	vector<data_t> compressed_buffer;
+	duckdb_zstd::ZSTD_CCtx *context;
+	RandomEngine random_engine;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<ZSTDAnalyzeState>(info);
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	// we always sample the first vector, so that we have an estimate
+	bool sample_selected = state.sampled_count == 0 || state.random_engine.NextRandom() < ANALYSIS_SAMPLE_SIZE;
+	auto string_limit = GetStringLimit(state.info.GetBlockSize());
+
+	state.count += count;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			if (sample_selected) {
+				state.frame.AppendNull();
+			}
+			continue;
+		}
+		// we need to check all strings for this, otherwise we run into trouble during compression if we miss one
+		if (data[idx].GetSize() > string_limit) {
+			return false;
+		}
+		if (sample_selected) {
+			state.frame.Append(data[idx]);
+			if (state.frame.IsFull()) {
+				state.CompressFrame();
+			}
+		}
+	}
+	if (sample_selected) {
+		state.sampled_count += count;
+	}
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	state.CompressFrame();
+	if (state.sampled_count == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	// extrapolate the sampled frames to the entire column
+	auto scale = double(state.count) / double(state.sampled_count);
+	auto estimated_frame_count = double(state.frame_count) * scale;
+	auto estimated_data_size = double(state.compressed_size) * scale;
+	auto estimated_metadata_size = estimated_frame_count * sizeof(zstd_frame_metadata_t);
+	auto estimated_base_size = estimated_data_size + estimated_metadata_size;
+	auto num_blocks = estimated_base_size / double(state.info.GetBlockSize() - sizeof(zstd_compression_header_t));
+	auto estimated_size = estimated_base_size + num_blocks * sizeof(zstd_compression_header_t);
+
+	return LossyNumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	ZSTDCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      frame(info.GetBlockSize()), frame_stats(StringStats::CreateEmpty(checkpointer.GetType())),
+	      context(duckdb_zstd::ZSTD_createCCtx()) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto compressed_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		current_segment = std::move(compressed_segment);
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		frames.clear();
+		data_size = 0;
+	}
+
+	void AddString(const string_t &str) {
+		frame.Append(str);
+		StringStats::Update(frame_stats, str);
+		if (frame.IsFull()) {
+			FlushFrame();
+		}
+	}
+
+	void AddNull() {
+		frame.AppendNull();
+		if (frame.IsFull()) {
+			FlushFrame();
+		}
+	}
+
+	idx_t GetRequiredSize(idx_t frame_count, idx_t frames_size) const {
+		return sizeof(zstd_compression_header_t) + frame_count * sizeof(zstd_frame_metadata_t) + frames_size;
+	}
+
+	//! Compresses the current frame and writes it to the current segment
+	void FlushFrame() {
+		if (frame.RowCount() == 0) {
+			return;
+		}
+		auto compressed_size = frame.Compress(context, compressed_buffer);
+		if (GetRequiredSize(frames.size() + 1, data_size + compressed_size) > info.GetBlockSize()) {
+			// the frame does not fit in the current segment anymore
+			FlushSegment();
+			if (GetRequiredSize(1, compressed_size) > info.GetBlockSize()) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+
+		// write the frame back-to-front from the end of the block
+		data_size += compressed_size;
+		zstd_frame_metadata_t metadata;
+		metadata.row_start = NumericCast<uint32_t>(current_segment->count.load());
+		metadata.offset = NumericCast<uint32_t>(info.GetBlockSize() - data_size);
+		metadata.compressed_size = NumericCast<uint32_t>(compressed_size);
+		metadata.uncompressed_size = NumericCast<uint32_t>(frame.UncompressedSize());
+		memcpy(current_handle.Ptr() + metadata.offset, compressed_buffer.data(), compressed_size);
+		frames.push_back(metadata);
+
+		current_segment->count += frame.RowCount();
+		current_segment->stats.statistics.Merge(frame_stats);
+		frame_stats = StringStats::CreateEmpty(checkpointer.GetType());
+		frame.Reset();
+	}
+
+	void FlushSegment(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		auto segment_size = Finalize();
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	idx_t Finalize() {
+		auto base_ptr = current_handle.Ptr();
+		auto metadata_size = sizeof(zstd_compression_header_t) + frames.size() * sizeof(zstd_frame_metadata_t);
+		auto total_size = metadata_size + data_size;
+		D_ASSERT(total_size <= info.GetBlockSize());
+
+		idx_t move_amount = 0;
+		if (total_size < info.GetCompactionFlushLimit()) {
+			// the block has space left: move the frames so they line up exactly with the metadata
+			move_amount = info.GetBlockSize() - total_size;
+			memmove(base_ptr + metadata_size, base_ptr + info.GetBlockSize() - data_size, data_size);
+		}
+
+		Store<uint32_t>(NumericCast<uint32_t>(frames.size()), base_ptr);
+		auto metadata_ptr = base_ptr + sizeof(zstd_compression_header_t);
+		for (auto &metadata : frames) {
+			metadata.offset -= NumericCast<uint32_t>(move_amount);
+			Store<zstd_frame_metadata_t>(metadata, metadata_ptr);
+			metadata_ptr += sizeof(zstd_frame_metadata_t);
+		}
+		current_handle.Destroy();
+
+		return move_amount == 0 ? info.GetBlockSize() : total_size;
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+
+	// State regarding the current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	//! The metadata of the frames written to the current segment
+	vector<zstd_frame_metadata_t> frames;
+	//! The total compressed size of the frames written to the current segment
+	idx_t data_size;
+
+	// State regarding the current frame
+	ZSTDFrameBuilder frame;
+	BaseStatistics frame_stats;
+	vector<data_t> compressed_buffer;
+	duckdb_zstd::ZSTD_CCtx *context;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer, analyze_state_p->info);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.AddNull();
+		} else {
+			state.AddString(data[idx]);
+		}
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.FlushFrame();
+	state.FlushSegment(true);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public StringScanState {
+	ZSTDScanState() : context(duckdb_zstd::ZSTD_createDCtx()) {
+	}
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	//! Makes sure the frame that contains "row" is decompressed
+	void LoadFrame(data_ptr_t base_ptr, idx_t row) {
+		if (current_frame.IsValid() && row >= frame_row_start && row < frame_row_start + frame_row_count) {
+			return;
+		}
+		auto frame_idx = ZSTDStorage::FindFrame(base_ptr, row);
+		auto frame = ZSTDStorage::GetFrameMetadata(base_ptr, frame_idx);
+		// the decompressed frame is shared with the vectors that reference its strings
+		frame_buffer = make_buffer<VectorBuffer>(frame.uncompressed_size);
+		ZSTDStorage::DecompressFrame(context, base_ptr, frame, frame_buffer->GetData());
+
+		// the row count of a frame is implied by its start and the start of the next frame (or the segment count)
+		auto frame_count = ZSTDStorage::GetFrameCount(base_ptr);
+		frame_row_start = frame.row_start;
+		if (frame_idx + 1 < frame_count) {
+			frame_row_count = ZSTDStorage::GetFrameMetadata(base_ptr, frame_idx + 1).row_start - frame_row_start;
+		} else {
+			frame_row_count = segment_count - frame_row_start;
+		}
+
+		// compute the offsets of the strings within the frame
+		auto lengths = reinterpret_cast<uint32_t *>(frame_buffer->GetData());
+		string_offsets.resize(frame_row_count);
+		idx_t offset = frame_row_count * sizeof(uint32_t);
+		for (idx_t i = 0; i < frame_row_count; i++) {
+			string_offsets[i] = offset;
+			offset += Load<uint32_t>(const_data_ptr_cast(lengths + i));
+		}
+		if (offset != frame.uncompressed_size) {
+			throw IOException("Corrupt ZSTD frame: string lengths do not match the frame size");
+		}
+		current_frame = frame_idx;
+	}
+
+	string_t GetString(idx_t row) {
+		auto frame_row = row - frame_row_start;
+		auto length = Load<uint32_t>(frame_buffer->GetData() + frame_row * sizeof(uint32_t));
+		return string_t(char_ptr_cast(frame_buffer->GetData() + string_offsets[frame_row]), length);
+	}
+
+	duckdb_zstd::ZSTD_DCtx *context;
+	idx_t segment_count;
+	optional_idx current_frame;
+	idx_t frame_row_start;
+	idx_t frame_row_count;
+	buffer_ptr<VectorBuffer> frame_buffer;
+	vector<idx_t> string_offsets;
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	state->segment_count = segment.count;
+	return std::move(state);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		scan_state.LoadFrame(base_ptr, row);
+		// the strings point into the decompressed frame, which the result vector keeps alive
+		StringVector::AddBuffer(result, scan_state.frame_buffer);
+		auto frame_end = scan_state.frame_row_start + scan_state.frame_row_count;
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, frame_end - row);
+		for (idx_t i = 0; i < to_scan; i++) {
+			result_data[result_offset + scanned + i] = scan_state.GetString(row + i);
+		}
+		scanned += to_scan;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	ZSTDScanState scan_state;
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	scan_state.handle = buffer_manager.Pin(segment.block);
+	scan_state.segment_count = segment.count;
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	scan_state.LoadFrame(base_ptr, row);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] = StringVector::AddStringOrBlob(result, scan_state.GetString(row));
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(const PhysicalType physical_type) {
+	return physical_type == PhysicalType::VARCHAR;
+}
+
+//===--------------------------------------------------------------------===//
+// Helper Functions
+//===--------------------------------------------------------------------===//
+idx_t ZSTDStorage::GetFrameCount(data_ptr_t base_ptr) {
+	return Load<uint32_t>(base_ptr);
+}
+
+zstd_frame_metadata_t ZSTDStorage::GetFrameMetadata(data_ptr_t base_ptr, idx_t frame_idx) {
+	return Load<zstd_frame_metadata_t>(base_ptr + sizeof(zstd_compression_header_t) +
+	                                   frame_idx * sizeof(zstd_frame_metadata_t));
+}
+
+idx_t ZSTDStorage::FindFrame(data_ptr_t base_ptr, idx_t row) {
+	// binary search for the last frame that starts at or before the row
+	idx_t lower = 0;
+	idx_t upper = GetFrameCount(base_ptr);
+	D_ASSERT(upper > 0);
+	while (upper - lower > 1) {
+		auto middle = lower + (upper - lower) / 2;
+		if (GetFrameMetadata(base_ptr, middle).row_start <= row) {
+			lower = middle;
+		} else {
+			upper = middle;
+		}
+	}
+	return lower;
+}
+
+void ZSTDStorage::DecompressFrame(duckdb_zstd::ZSTD_DCtx *context, data_ptr_t base_ptr,
+                                  const zstd_frame_metadata_t &frame, data_ptr_t target) {
+	auto decompressed_size = duckdb_zstd::ZSTD_decompressDCtx(context, target, frame.uncompressed_size,
+	                                                          base_ptr + frame.offset, frame.compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != frame.uncompressed_size) {
+		throw IOException("Failed to decompress ZSTD frame");
+	}
+}
+
+} // namespace duckdb
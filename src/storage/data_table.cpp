@@ -32,7 +32,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      last_commit_id(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -317,6 +318,10 @@ void DataTable::SetIndexStorageInfo(vector<IndexStorageInfo> index_storage_info)
 	info->index_storage_infos = std::move(index_storage_info);
 }
 
+void DataTable::SetSortKeys(vector<PhysicalIndex> sort_keys) {
+	row_groups->SetSortKeys(std::move(sort_keys));
+}
+
 void DataTable::VacuumIndexes() {
 	info->indexes.Scan([&](Index &index) {
 		if (index.IsBound()) {
@@ -1382,6 +1387,18 @@ void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> d
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
 }
 
+unique_ptr<HistogramStatistics> DataTable::GetHistogram(column_t column_id) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	return row_groups->CopyHistogram(column_id);
+}
+
+void DataTable::SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	row_groups->SetHistogram(column_id, std::move(histogram));
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -10,6 +10,7 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -21,6 +22,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	auto filter_type = deserializer.ReadProperty<TableFilterType>(100, "filter_type");
 	unique_ptr<TableFilter> result;
 	switch (filter_type) {
+	case TableFilterType::BLOOM_FILTER:
+		result = BloomFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::CONJUNCTION_AND:
 		result = ConjunctionAndFilter::Deserialize(deserializer);
 		break;
@@ -450,7 +450,27 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	// read the buffer from disk
 	auto location = GetBlockLocation(start_block);
 	buffer.Read(*handle, location);
+	VerifyBlocks(buffer, location, block_count);
+}
+
+void SingleFileBlockManager::ReadBlockRanges(vector<BlockReadRange> &ranges) {
+	vector<FileReadRequest> requests;
+	requests.reserve(ranges.size());
+	for (auto &range : ranges) {
+		D_ASSERT(range.start_block >= 0);
+		D_ASSERT(range.block_count >= 1);
+		auto &buffer = range.buffer.get();
+		requests.emplace_back(buffer.InternalBuffer(), buffer.AllocSize(), GetBlockLocation(range.start_block));
+	}
+	// read all ranges from disk as a single batch
+	handle->ReadBatch(requests);
+	for (idx_t range_idx = 0; range_idx < ranges.size(); range_idx++) {
+		auto &range = ranges[range_idx];
+		VerifyBlocks(range.buffer.get(), requests[range_idx].location, range.block_count);
+	}
+}
 
+void SingleFileBlockManager::VerifyBlocks(FileBuffer &buffer, uint64_t location, idx_t block_count) const {
 	// for each of the blocks - verify the checksum
 	auto ptr = buffer.InternalBuffer();
 	for (idx_t i = 0; i < block_count; i++) {
@@ -208,56 +208,63 @@ void StandardBufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t bl
 }
 
 void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-                                      block_id_t first_block, block_id_t last_block) {
+                                      const vector<pair<block_id_t, idx_t>> &ranges) {
 	auto &block_manager = handles[0]->block_manager;
-	idx_t block_count = NumericCast<idx_t>(last_block - first_block + 1);
-#ifndef DUCKDB_ALTERNATIVE_VERIFY
-	if (block_count == 1) {
-		// prefetching with block_count == 1 has no performance impact since we can't batch reads
-		// skip the prefetch in this case
-		// we do it anyway if alternative_verify is on for extra testing
-		return;
-	}
-#endif
 
-	// allocate a buffer to hold the data of all of the blocks
-	auto intermediate_buffer = Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize());
-	// perform a batch read of the blocks into the buffer
-	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
+	// allocate a buffer to hold the data of each range of blocks
+	vector<BufferHandle> intermediate_buffers;
+	vector<BlockReadRange> read_ranges;
+	intermediate_buffers.reserve(ranges.size());
+	read_ranges.reserve(ranges.size());
+	for (auto &range : ranges) {
+		intermediate_buffers.push_back(Allocate(MemoryTag::BASE_TABLE, range.second * block_manager.GetBlockSize()));
+		read_ranges.emplace_back(intermediate_buffers.back().GetFileBuffer(), range.first, range.second);
+	}
+	// perform a batch read of all ranges of blocks
+	block_manager.ReadBlockRanges(read_ranges);
 
 	// the blocks are read - now we need to assign them to the individual blocks
-	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
-		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
-		auto entry = load_map.find(block_id);
-		D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
-		auto &handle = handles[entry->second];
-
-		// reserve memory for the block
-		idx_t required_memory = handle->memory_usage;
-		unique_ptr<FileBuffer> reusable_buffer;
-		auto reservation =
-		    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
-		                       StringUtil::BytesToHumanReadableString(required_memory));
-		// now load the block from the buffer
-		// note that we discard the buffer handle - we do not keep it around
-		// the prefetching relies on the block handle being pinned again during the actual read before it is evicted
-		BufferHandle buf;
-		{
-			lock_guard<mutex> lock(handle->lock);
-			if (handle->state == BlockState::BLOCK_LOADED) {
-				// the block is loaded already by another thread - free up the reservation and continue
-				reservation.Resize(0);
-				continue;
+	for (idx_t range_idx = 0; range_idx < ranges.size(); range_idx++) {
+		auto &intermediate_buffer = intermediate_buffers[range_idx];
+		for (idx_t block_idx = 0; block_idx < ranges[range_idx].second; block_idx++) {
+			block_id_t block_id = ranges[range_idx].first + NumericCast<block_id_t>(block_idx);
+			auto entry = load_map.find(block_id);
+			D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
+			auto &handle = handles[entry->second];
+
+			// reserve memory for the block
+			idx_t required_memory = handle->memory_usage;
+			unique_ptr<FileBuffer> reusable_buffer;
+			auto reservation =
+			    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
+			                       StringUtil::BytesToHumanReadableString(required_memory));
+			// now load the block from the buffer
+			// note that we discard the buffer handle - we do not keep it around
+			// the prefetching relies on the block handle being pinned again during the actual read before it is
+			// evicted
+			BufferHandle buf;
+			{
+				lock_guard<mutex> lock(handle->lock);
+				if (handle->state == BlockState::BLOCK_LOADED) {
+					// the block is loaded already by another thread - free up the reservation and continue
+					reservation.Resize(0);
+					continue;
+				}
+				auto block_ptr = intermediate_buffer.GetFileBuffer().InternalBuffer() +
+				                 block_idx * block_manager.GetBlockAllocSize();
+				buf = BlockHandle::LoadFromBuffer(handle, block_ptr, std::move(reusable_buffer));
+				handle->readers = 1;
+				handle->memory_charge = std::move(reservation);
+				// the pin that follows the prefetch counts as the miss, and does not count as re-use of the block
+				handle->prefetched = true;
 			}
-			auto block_ptr =
-			    intermediate_buffer.GetFileBuffer().InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
-			buf = BlockHandle::LoadFromBuffer(handle, block_ptr, std::move(reusable_buffer));
-			handle->readers = 1;
-			handle->memory_charge = std::move(reservation);
 		}
 	}
 }
 
+//! The maximum number of blocks that are read in a single batch when prefetching
+static constexpr idx_t PREFETCH_BATCH_BLOCKS = 64;
+
 void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 	// figure out which set of blocks we should load
 	map<block_id_t, idx_t> to_be_loaded;
@@ -273,29 +280,37 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
-	block_id_t first_block = -1;
-	block_id_t previous_block_id = -1;
+#ifndef DUCKDB_ALTERNATIVE_VERIFY
+	if (to_be_loaded.size() == 1) {
+		// prefetching a single block has no performance impact since we can't batch reads
+		// skip the prefetch in this case
+		// we do it anyway if alternative_verify is on for extra testing
+		return;
+	}
+#endif
+	// gather the blocks into ranges of adjacent blocks - each range is read with a single read
+	// the ranges are read in batches, so that the reads of all ranges in a batch can be in flight at the same time
+	vector<pair<block_id_t, idx_t>> ranges;
+	idx_t batch_blocks = 0;
 	for (auto &entry : to_be_loaded) {
-		if (previous_block_id < 0) {
-			// this the first block we are seeing
-			first_block = entry.first;
-			previous_block_id = first_block;
-		} else if (previous_block_id + 1 == entry.first) {
-			// this block is adjacent to the previous block - add it to the batch read
-			previous_block_id = entry.first;
+		if (!ranges.empty() && ranges.back().first + NumericCast<block_id_t>(ranges.back().second) == entry.first) {
+			// this block is adjacent to the previous block - add it to the range
+			ranges.back().second++;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
-
-			// set the first_block and previous_block_id to the current block
-			first_block = entry.first;
-			previous_block_id = entry.first;
+			// this block is not adjacent to the previous block - start a new range
+			ranges.emplace_back(entry.first, 1);
 		}
+		batch_blocks++;
+		if (batch_blocks >= PREFETCH_BATCH_BLOCKS) {
+			BatchRead(handles, to_be_loaded, ranges);
+			ranges.clear();
+			batch_blocks = 0;
+		}
+	}
+	if (!ranges.empty()) {
+		// batch read the final ranges
+		BatchRead(handles, to_be_loaded, ranges);
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -311,6 +326,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
+			buffer_pool.RegisterPin(*handle, true);
 			handle->readers++;
 			buf = handle->Load(handle);
 		}
@@ -331,12 +347,14 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			buffer_pool.RegisterPin(*handle, true);
 			handle->readers++;
 			reservation.Resize(0);
 			buf = handle->Load(handle);
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
+			buffer_pool.RegisterPin(*handle, false);
 			handle->readers = 1;
 			buf = handle->Load(handle, std::move(reusable_buffer));
 			handle->memory_charge = std::move(reservation);
@@ -420,6 +438,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage.GetUsedMemory(MemoryTag(k), BufferPool::MemoryUsageCaches::FLUSH);
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_pool.GetBufferHits(MemoryTag(k));
+		info.buffer_misses = buffer_pool.GetBufferMisses(MemoryTag(k));
 		result.push_back(info);
 	}
 	return result;
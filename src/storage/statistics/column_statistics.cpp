@@ -9,8 +9,9 @@ ColumnStatistics::ColumnStatistics(BaseStatistics stats_p) : stats(std::move(sta
 		distinct_stats = make_uniq<DistinctStatistics>();
 	}
 }
-ColumnStatistics::ColumnStatistics(BaseStatistics stats_p, unique_ptr<DistinctStatistics> distinct_stats_p)
-    : stats(std::move(stats_p)), distinct_stats(std::move(distinct_stats_p)) {
+ColumnStatistics::ColumnStatistics(BaseStatistics stats_p, unique_ptr<DistinctStatistics> distinct_stats_p,
+                                   unique_ptr<HistogramStatistics> histogram_p)
+    : stats(std::move(stats_p)), distinct_stats(std::move(distinct_stats_p)), histogram(std::move(histogram_p)) {
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::CreateEmptyStats(const LogicalType &type) {
@@ -44,6 +45,21 @@ void ColumnStatistics::SetDistinct(unique_ptr<DistinctStatistics> distinct) {
 	this->distinct_stats = std::move(distinct);
 }
 
+bool ColumnStatistics::HasHistogram() {
+	return histogram.get();
+}
+
+HistogramStatistics &ColumnStatistics::Histogram() {
+	if (!histogram) {
+		throw InternalException("Histogram called without histogram");
+	}
+	return *histogram;
+}
+
+void ColumnStatistics::SetHistogram(unique_ptr<HistogramStatistics> histogram_p) {
+	this->histogram = std::move(histogram_p);
+}
+
 void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 	if (!distinct_stats) {
 		return;
@@ -53,19 +69,25 @@ void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Copy() const {
-	return make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	return make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr,
+	                                         histogram ? histogram->Copy() : nullptr);
 }
 
 void ColumnStatistics::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty(100, "statistics", stats);
 	serializer.WritePropertyWithDefault(101, "distinct", distinct_stats, unique_ptr<DistinctStatistics>());
+	if (serializer.ShouldSerialize(4)) {
+		serializer.WritePropertyWithDefault(102, "histogram", histogram, unique_ptr<HistogramStatistics>());
+	}
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Deserialize(Deserializer &deserializer) {
 	auto stats = deserializer.ReadProperty<BaseStatistics>(100, "statistics");
 	auto distinct_stats = deserializer.ReadPropertyWithDefault<unique_ptr<DistinctStatistics>>(
 	    101, "distinct", unique_ptr<DistinctStatistics>());
-	return make_shared_ptr<ColumnStatistics>(std::move(stats), std::move(distinct_stats));
+	auto histogram = deserializer.ReadPropertyWithDefault<unique_ptr<HistogramStatistics>>(
+	    102, "histogram", unique_ptr<HistogramStatistics>());
+	return make_shared_ptr<ColumnStatistics>(std::move(stats), std::move(distinct_stats), std::move(histogram));
 }
 
 } // namespace duckdb
@@ -0,0 +1,300 @@
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/types/uhugeint.hpp"
+#include "duckdb/common/types/value_map.hpp"
+
+namespace duckdb {
+
+HistogramStatistics::HistogramStatistics(LogicalType type_p, vector<Value> mcv_values_p,
+                                         vector<double> mcv_frequencies_p, vector<double> bounds_p,
+                                         double histogram_fraction_p)
+    : type(std::move(type_p)), mcv_values(std::move(mcv_values_p)), mcv_frequencies(std::move(mcv_frequencies_p)),
+      bounds(std::move(bounds_p)), histogram_fraction(histogram_fraction_p) {
+	D_ASSERT(mcv_values.size() == mcv_frequencies.size());
+}
+
+unique_ptr<HistogramStatistics> HistogramStatistics::Copy() const {
+	return make_uniq<HistogramStatistics>(type, mcv_values, mcv_frequencies, bounds, histogram_fraction);
+}
+
+bool HistogramStatistics::TypeIsSupported(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::TIME_TZ || type.id() == LogicalTypeId::ENUM) {
+		// the physical values of these types are not ordered like their logical values
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool HistogramStatistics::TryGetNumericValue(const Value &value, double &result) {
+	if (value.IsNull()) {
+		return false;
+	}
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT8:
+		result = double(value.GetValueUnsafe<int8_t>());
+		return true;
+	case PhysicalType::INT16:
+		result = double(value.GetValueUnsafe<int16_t>());
+		return true;
+	case PhysicalType::INT32:
+		result = double(value.GetValueUnsafe<int32_t>());
+		return true;
+	case PhysicalType::INT64:
+		result = double(value.GetValueUnsafe<int64_t>());
+		return true;
+	case PhysicalType::INT128:
+		result = Hugeint::Cast<double>(value.GetValueUnsafe<hugeint_t>());
+		return true;
+	case PhysicalType::UINT8:
+		result = double(value.GetValueUnsafe<uint8_t>());
+		return true;
+	case PhysicalType::UINT16:
+		result = double(value.GetValueUnsafe<uint16_t>());
+		return true;
+	case PhysicalType::UINT32:
+		result = double(value.GetValueUnsafe<uint32_t>());
+		return true;
+	case PhysicalType::UINT64:
+		result = double(value.GetValueUnsafe<uint64_t>());
+		return true;
+	case PhysicalType::UINT128:
+		result = Uhugeint::Cast<double>(value.GetValueUnsafe<uhugeint_t>());
+		return true;
+	case PhysicalType::FLOAT:
+		result = double(value.GetValueUnsafe<float>());
+		return true;
+	case PhysicalType::DOUBLE:
+		result = value.GetValueUnsafe<double>();
+		return true;
+	default:
+		return false;
+	}
+}
+
+unique_ptr<HistogramStatistics> HistogramStatistics::Build(const LogicalType &type, const vector<Value> &values,
+                                                           const vector<double> &weights, double total_weight) {
+	D_ASSERT(values.size() == weights.size());
+	if (!TypeIsSupported(type) || total_weight <= 0) {
+		return nullptr;
+	}
+
+	// count how often (and with which weight) every value occurs in the sample
+	struct SampledValue {
+		idx_t count = 0;
+		double weight = 0;
+	};
+	value_map_t<SampledValue> sampled_values;
+	double non_null_weight = 0;
+	for (idx_t i = 0; i < values.size(); i++) {
+		auto &entry = sampled_values[values[i]];
+		entry.count++;
+		entry.weight += weights[i];
+		non_null_weight += weights[i];
+	}
+
+	// the most common values are values that occur more than once in the sample, and more often than average
+	vector<pair<Value, double>> candidates;
+	if (!sampled_values.empty()) {
+		auto average_weight = non_null_weight / double(sampled_values.size());
+		for (auto &entry : sampled_values) {
+			if (entry.second.count > 1 && entry.second.weight > average_weight) {
+				candidates.emplace_back(entry.first, entry.second.weight);
+			}
+		}
+	}
+	std::sort(candidates.begin(), candidates.end(),
+	          [](const pair<Value, double> &a, const pair<Value, double> &b) { return a.second > b.second; });
+	if (candidates.size() > MAX_MCV_COUNT) {
+		candidates.resize(MAX_MCV_COUNT);
+	}
+	value_set_t mcv_set;
+	vector<Value> mcv_values;
+	vector<double> mcv_frequencies;
+	for (auto &candidate : candidates) {
+		mcv_set.insert(candidate.first);
+		mcv_values.push_back(candidate.first);
+		mcv_frequencies.push_back(candidate.second / total_weight);
+	}
+
+	// the histogram covers the remaining values
+	vector<pair<double, double>> remaining;
+	double remaining_weight = 0;
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (mcv_set.find(values[i]) != mcv_set.end()) {
+			continue;
+		}
+		double numeric_value;
+		if (!TryGetNumericValue(values[i], numeric_value) || !Value::DoubleIsFinite(numeric_value)) {
+			// infinities and NaNs cannot be interpolated
+			continue;
+		}
+		remaining.emplace_back(numeric_value, weights[i]);
+		remaining_weight += weights[i];
+	}
+	std::sort(remaining.begin(), remaining.end());
+
+	vector<double> bounds;
+	if (!remaining.empty()) {
+		auto bucket_count = MinValue<idx_t>(MAX_BUCKET_COUNT, remaining.size());
+		bounds.push_back(remaining[0].first);
+		idx_t entry_idx = 0;
+		double cumulative_weight = 0;
+		for (idx_t bucket_idx = 1; bucket_idx < bucket_count; bucket_idx++) {
+			// every bucket ends at the value where the cumulative weight passes its share of the rows
+			auto target_weight = remaining_weight * double(bucket_idx) / double(bucket_count);
+			while (entry_idx + 1 < remaining.size() &&
+			       cumulative_weight + remaining[entry_idx].second < target_weight) {
+				cumulative_weight += remaining[entry_idx].second;
+				entry_idx++;
+			}
+			bounds.push_back(remaining[entry_idx].first);
+		}
+		bounds.push_back(remaining.back().first);
+	}
+	return make_uniq<HistogramStatistics>(type, std::move(mcv_values), std::move(mcv_frequencies), std::move(bounds),
+	                                      remaining_weight / total_weight);
+}
+
+bool HistogramStatistics::CanEstimate(const Value &constant) const {
+	return !constant.IsNull() && constant.type() == type;
+}
+
+double HistogramStatistics::NonNullFraction() const {
+	double result = histogram_fraction;
+	for (auto &frequency : mcv_frequencies) {
+		result += frequency;
+	}
+	return MinValue<double>(result, 1.0);
+}
+
+double HistogramStatistics::HistogramLessThan(double value, bool inclusive) const {
+	if (bounds.empty()) {
+		return 0;
+	}
+	if (value < bounds.front()) {
+		return 0;
+	}
+	if (value > bounds.back()) {
+		return 1;
+	}
+	auto bucket_count = bounds.size() - 1;
+	if (bucket_count == 0) {
+		// all values of the histogram are the same
+		return inclusive ? 1 : 0;
+	}
+	// find the first bound that is bigger than the value (or bigger than or equal to the value, if it is excluded)
+	auto entry = inclusive ? std::upper_bound(bounds.begin(), bounds.end(), value)
+	                       : std::lower_bound(bounds.begin(), bounds.end(), value);
+	auto bound_idx = NumericCast<idx_t>(entry - bounds.begin());
+	if (bound_idx == 0) {
+		return 0;
+	}
+	if (bound_idx > bucket_count) {
+		return 1;
+	}
+	// interpolate within the bucket
+	auto lower = bounds[bound_idx - 1];
+	auto upper = bounds[bound_idx];
+	double bucket_fraction = upper > lower ? (value - lower) / (upper - lower) : 0;
+	bucket_fraction = MaxValue<double>(0, MinValue<double>(1, bucket_fraction));
+	return (double(bound_idx - 1) + bucket_fraction) / double(bucket_count);
+}
+
+double HistogramStatistics::EstimateLessThan(const Value &constant, bool inclusive) const {
+	double value;
+	if (!TryGetNumericValue(constant, value)) {
+		return 1;
+	}
+	double result = 0;
+	for (idx_t i = 0; i < mcv_values.size(); i++) {
+		double mcv_value;
+		if (!TryGetNumericValue(mcv_values[i], mcv_value)) {
+			continue;
+		}
+		if (mcv_value < value || (inclusive && mcv_value == value)) {
+			result += mcv_frequencies[i];
+		}
+	}
+	return result + histogram_fraction * HistogramLessThan(value, inclusive);
+}
+
+double HistogramStatistics::EstimateEquality(const Value &constant, idx_t distinct_count) const {
+	double value;
+	if (!TryGetNumericValue(constant, value)) {
+		return 1;
+	}
+	for (idx_t i = 0; i < mcv_values.size(); i++) {
+		double mcv_value;
+		if (TryGetNumericValue(mcv_values[i], mcv_value) && mcv_value == value) {
+			return mcv_frequencies[i];
+		}
+	}
+	if (bounds.empty() || value < bounds.front() || value > bounds.back()) {
+		// the value is outside of the range of the (non-common) values
+		return 0;
+	}
+	// the remaining values are assumed to be uniformly distributed
+	auto remaining_distinct = distinct_count > mcv_values.size() ? distinct_count - mcv_values.size() : 1;
+	return histogram_fraction / double(remaining_distinct);
+}
+
+idx_t HistogramStatistics::EstimateJoinDistinctCount(idx_t distinct_count) const {
+	auto non_null_fraction = NonNullFraction();
+	if (distinct_count <= 1 || non_null_fraction <= 0) {
+		return distinct_count;
+	}
+	// the expected number of matches of a row in a self-join is the sum of the squared value frequencies
+	double frequency_sum = 0;
+	for (auto &frequency : mcv_frequencies) {
+		auto relative_frequency = frequency / non_null_fraction;
+		frequency_sum += relative_frequency * relative_frequency;
+	}
+	auto remaining_distinct = distinct_count > mcv_values.size() ? distinct_count - mcv_values.size() : 1;
+	auto remaining_fraction = histogram_fraction / non_null_fraction;
+	frequency_sum += remaining_fraction * remaining_fraction / double(remaining_distinct);
+	if (frequency_sum <= 0) {
+		return distinct_count;
+	}
+	auto effective_distinct = LossyNumericCast<idx_t>(1.0 / frequency_sum);
+	return MaxValue<idx_t>(1, MinValue<idx_t>(distinct_count, effective_distinct));
+}
+
+void HistogramStatistics::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "type", type);
+	serializer.WritePropertyWithDefault(101, "mcv_values", mcv_values);
+	serializer.WritePropertyWithDefault(102, "mcv_frequencies", mcv_frequencies);
+	serializer.WritePropertyWithDefault(103, "bounds", bounds);
+	serializer.WriteProperty(104, "histogram_fraction", histogram_fraction);
+}
+
+unique_ptr<HistogramStatistics> HistogramStatistics::Deserialize(Deserializer &deserializer) {
+	auto type = deserializer.ReadProperty<LogicalType>(100, "type");
+	auto mcv_values = deserializer.ReadPropertyWithDefault<vector<Value>>(101, "mcv_values");
+	auto mcv_frequencies = deserializer.ReadPropertyWithDefault<vector<double>>(102, "mcv_frequencies");
+	auto bounds = deserializer.ReadPropertyWithDefault<vector<double>>(103, "bounds");
+	auto histogram_fraction = deserializer.ReadProperty<double>(104, "histogram_fraction");
+	return make_uniq<HistogramStatistics>(std::move(type), std::move(mcv_values), std::move(mcv_frequencies),
+	                                      std::move(bounds), histogram_fraction);
+}
+
+} // namespace duckdb
@@ -234,7 +234,7 @@ public:
 
 	//! Revert the commit
 	void RevertCommit() override;
-	// Make the commit persistent
+	// Write the commit to the WAL
 	void FlushCommit() override;
 
 private:
@@ -277,7 +277,9 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	// the entries are made durable by the transaction manager, which syncs the WAL after releasing its locks so that
+	// the syncs of concurrent commits can be combined
+	wal.WriteFlush();
 	state = WALCommitState::FLUSHED;
 }
 
@@ -109,6 +109,18 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method == CompressionType::COMPRESSION_AUTO) {
+		// ZSTD segments cannot be read by older versions - only pick it automatically if we do not need to be
+		// compatible with them
+		auto latest_version = SerializationCompatibility::Latest().serialization_version;
+		if (config.options.serialization_compatibility.serialization_version < latest_version) {
+			for (auto &compression_function : compression_functions) {
+				if (compression_function && compression_function->type == CompressionType::COMPRESSION_ZSTD) {
+					compression_function = nullptr;
+				}
+			}
+		}
+	}
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
@@ -403,6 +403,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -491,26 +492,36 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 			count = max_count;
 		}
 		auto &block_manager = GetBlockManager();
+		bool has_filters = filter_info.HasFilters();
+		// the number of rows for which we prefetch the blocks
+		idx_t prefetch_count = 0;
 #ifndef DUCKDB_ALTERNATIVE_VERIFY
-		// // in regular operation we only prefetch from remote file systems
+		// // in regular operation we prefetch every vector only from remote file systems
 		// // when alternative verify is set, we always prefetch for testing purposes
 		if (block_manager.IsRemote())
 #else
 		if (!block_manager.InMemory())
 #endif
 		{
+			prefetch_count = max_count;
+		}
+		if (current_row == 0 && !has_filters && !block_manager.InMemory()) {
+			// we start scanning a row group without filters - we will read all of its blocks
+			// prefetch them all at once, so that the reads are issued as a single batch instead of one at a time
+			prefetch_count = state.max_row_group_row;
+		}
+		if (prefetch_count > 0) {
 			PrefetchState prefetch_state;
 			for (idx_t i = 0; i < column_ids.size(); i++) {
 				const auto &column = column_ids[i];
 				if (column != COLUMN_IDENTIFIER_ROW_ID) {
-					GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], max_count);
+					GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], prefetch_count);
 				}
 			}
 			auto &buffer_manager = block_manager.buffer_manager;
 			buffer_manager.Prefetch(prefetch_state.blocks);
 		}
 
-		bool has_filters = filter_info.HasFilters();
 		if (count == max_count && !has_filters) {
 			// scan all vectors completely: full scan without deletions or table filters
 			for (idx_t i = 0; i < column_ids.size(); i++) {
@@ -15,6 +15,10 @@
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -55,7 +59,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), allocation_size(0), unsorted_row_start(NumericLimits<idx_t>::Maximum()) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -310,6 +314,7 @@ void RowGroupCollection::InitializeAppend(TransactionData transaction, TableAppe
 	state.row_start = UnsafeNumericCast<row_t>(total_rows.load());
 	state.current_row = state.row_start;
 	state.total_append_count = 0;
+	MarkUnsorted(row_start + total_rows.load());
 
 	// start writing to the row_groups
 	auto l = row_groups->Lock();
@@ -466,6 +471,7 @@ void RowGroupCollection::CleanupAppend(transaction_t lowest_transaction, idx_t s
 void RowGroupCollection::MergeStorage(RowGroupCollection &data) {
 	D_ASSERT(data.types == types);
 	auto index = row_start + total_rows.load();
+	MarkUnsorted(index);
 	auto segments = data.row_groups->MoveSegments();
 	for (auto &entry : segments) {
 		auto &row_group = entry.node;
@@ -534,6 +540,12 @@ void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const v
 			}
 		}
 		row_group->Update(transaction, updates, ids, start, pos - start, column_ids);
+		for (auto &column_id : column_ids) {
+			if (IsSortKey(column_id.index)) {
+				MarkUnsorted(row_group->start);
+				break;
+			}
+		}
 
 		auto l = stats.GetLock();
 		for (idx_t i = 0; i < column_ids.size(); i++) {
@@ -618,6 +630,9 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 	auto primary_column_idx = column_path[0];
 	auto row_group = row_groups->GetSegment(UnsafeNumericCast<idx_t>(first_id));
 	row_group->UpdateColumn(transaction, updates, row_ids, column_path);
+	if (IsSortKey(primary_column_idx)) {
+		MarkUnsorted(row_group->start);
+	}
 
 	auto lock = stats.GetLock();
 	row_group->MergeIntoStatistics(primary_column_idx, stats.GetStats(*lock, primary_column_idx).Statistics());
@@ -882,6 +897,208 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	return true;
 }
 
+//===--------------------------------------------------------------------===//
+// Sort
+//===--------------------------------------------------------------------===//
+void RowGroupCollection::SetSortKeys(vector<PhysicalIndex> sort_keys_p) {
+	if (sort_keys == sort_keys_p) {
+		return;
+	}
+	sort_keys = std::move(sort_keys_p);
+}
+
+bool RowGroupCollection::IsSortKey(idx_t column_idx) const {
+	for (auto &sort_key : sort_keys) {
+		if (sort_key.index == column_idx) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void RowGroupCollection::MarkUnsorted(idx_t row_idx) {
+	if (sort_keys.empty()) {
+		return;
+	}
+	auto current = unsorted_row_start.load();
+	while (row_idx < current && !unsorted_row_start.compare_exchange_weak(current, row_idx)) {
+	}
+}
+
+static bool SortedRowGroupOverlaps(const BaseStatistics &sorted_stats, const Value &unsorted_min) {
+	if (sorted_stats.CanHaveNull() || !NumericStats::HasMinMax(sorted_stats)) {
+		// NULL values are sorted last - any rows that follow them need to be merged with them
+		return true;
+	}
+	if (unsorted_min.IsNull()) {
+		// the unsorted rows only contain NULL values
+		return false;
+	}
+	return NumericStats::Max(sorted_stats) >= unsorted_min;
+}
+
+void RowGroupCollection::SortRowGroups(TableDataWriter &writer, vector<SegmentNode<RowGroup>> &segments) {
+	if (sort_keys.empty()) {
+		return;
+	}
+	// sorting changes the row ids of the rows - this is only possible in the same situations in which we can vacuum
+	bool is_full_checkpoint = writer.GetCheckpointType() == CheckpointType::FULL_CHECKPOINT;
+	if (!is_full_checkpoint || !info->GetIndexes().Empty()) {
+		return;
+	}
+	// find the first row group that contains rows that were modified since the rows were last sorted
+	auto unsorted_start = unsorted_row_start.load();
+	idx_t sort_start_idx;
+	for (sort_start_idx = 0; sort_start_idx < segments.size(); sort_start_idx++) {
+		auto &row_group = *segments[sort_start_idx].node;
+		if (row_group.start + row_group.count > unsorted_start) {
+			break;
+		}
+	}
+	if (sort_start_idx >= segments.size()) {
+		// all rows are sorted already
+		unsorted_row_start = NumericLimits<idx_t>::Maximum();
+		return;
+	}
+	// the row groups before are sorted - but the range of their first sort key might overlap with the modified rows
+	// include all sorted row groups that overlap in the sort, so that the rows are merged with the modified rows
+	auto first_key = sort_keys[0].index;
+	if (BaseStatistics::GetStatsType(types[first_key]) == StatisticsType::NUMERIC_STATS) {
+		Value unsorted_min;
+		for (idx_t segment_idx = sort_start_idx; segment_idx < segments.size(); segment_idx++) {
+			auto row_group_stats = segments[segment_idx].node->GetStatistics(first_key);
+			if (!NumericStats::HasMinMax(*row_group_stats)) {
+				continue;
+			}
+			auto row_group_min = NumericStats::Min(*row_group_stats);
+			if (unsorted_min.IsNull() || row_group_min < unsorted_min) {
+				unsorted_min = std::move(row_group_min);
+			}
+		}
+		while (sort_start_idx > 0) {
+			auto row_group_stats = segments[sort_start_idx - 1].node->GetStatistics(first_key);
+			if (!SortedRowGroupOverlaps(*row_group_stats, unsorted_min)) {
+				break;
+			}
+			sort_start_idx--;
+		}
+	} else {
+		// the statistics of other types (e.g. string prefixes) are not precise enough - sort all rows
+		sort_start_idx = 0;
+	}
+
+	// sink the committed rows of the row groups into a sort
+	auto &buffer_manager = BufferManager::GetBufferManager(GetAttached());
+	vector<BoundOrderByNode> orders;
+	vector<LogicalType> key_types;
+	for (auto &sort_key : sort_keys) {
+		auto &key_type = types[sort_key.index];
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+		                    make_uniq<BoundReferenceExpression>(key_type, orders.size()));
+		key_types.push_back(key_type);
+	}
+	RowLayout payload_layout;
+	payload_layout.Initialize(types);
+	GlobalSortState global_sort_state(buffer_manager, orders, payload_layout);
+	LocalSortState local_sort_state;
+	local_sort_state.Initialize(global_sort_state, buffer_manager);
+	// sort runs of rows whenever the unsorted data grows too large, so that they can be spilled to disk
+	auto max_unsorted_size = buffer_manager.GetQueryMaxMemory() / 4;
+
+	vector<column_t> column_ids;
+	for (idx_t c = 0; c < types.size(); c++) {
+		column_ids.push_back(c);
+	}
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(Allocator::DefaultAllocator(), types);
+	DataChunk key_chunk;
+	key_chunk.InitializeEmpty(key_types);
+
+	TableScanState scan_state;
+	scan_state.Initialize(column_ids);
+	scan_state.table_state.Initialize(types);
+	scan_state.table_state.max_row = idx_t(-1);
+	auto row_group_start = segments[sort_start_idx].node->start;
+	idx_t sorted_count = 0;
+	for (idx_t segment_idx = sort_start_idx; segment_idx < segments.size(); segment_idx++) {
+		auto &row_group = *segments[segment_idx].node;
+		row_group.InitializeScan(scan_state.table_state);
+		while (true) {
+			scan_chunk.Reset();
+			row_group.ScanCommitted(scan_state.table_state, scan_chunk,
+			                        TableScanType::TABLE_SCAN_LATEST_COMMITTED_ROWS);
+			if (scan_chunk.size() == 0) {
+				break;
+			}
+			for (idx_t key_idx = 0; key_idx < sort_keys.size(); key_idx++) {
+				key_chunk.data[key_idx].Reference(scan_chunk.data[sort_keys[key_idx].index]);
+			}
+			key_chunk.SetCardinality(scan_chunk);
+			local_sort_state.SinkChunk(key_chunk, scan_chunk);
+			sorted_count += scan_chunk.size();
+			if (local_sort_state.SizeInBytes() >= max_unsorted_size) {
+				local_sort_state.Sort(global_sort_state, true);
+			}
+		}
+	}
+	// the rows now live in the sort - drop the original row groups
+	for (idx_t segment_idx = sort_start_idx; segment_idx < segments.size(); segment_idx++) {
+		segments[segment_idx].node->CommitDrop();
+	}
+	segments.erase(segments.begin() + NumericCast<int64_t>(sort_start_idx), segments.end());
+	unsorted_row_start = NumericLimits<idx_t>::Maximum();
+	if (sorted_count == 0) {
+		return;
+	}
+	global_sort_state.AddLocalState(local_sort_state);
+	global_sort_state.PrepareMergePhase();
+	while (global_sort_state.sorted_blocks.size() > 1) {
+		global_sort_state.InitializeMergeRound();
+		MergeSorter merge_sorter(global_sort_state, buffer_manager);
+		merge_sorter.PerformInMergeRound();
+		global_sort_state.CompleteMergeRound();
+	}
+
+	// write the sorted rows into new row groups
+	PayloadScanner scanner(global_sort_state);
+	DataChunk sorted_chunk;
+	sorted_chunk.Initialize(Allocator::DefaultAllocator(), types);
+	DataChunk append_chunk;
+	append_chunk.InitializeEmpty(types);
+	idx_t chunk_offset = 0;
+	idx_t remaining = sorted_count;
+	while (remaining > 0) {
+		auto row_group_count = MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE);
+		auto new_row_group = make_uniq<RowGroup>(*this, row_group_start, row_group_count);
+		new_row_group->InitializeEmpty(types);
+		TableAppendState append_state;
+		new_row_group->InitializeAppend(append_state.row_group_append_state);
+		idx_t append_count = 0;
+		while (append_count < row_group_count) {
+			if (chunk_offset >= sorted_chunk.size()) {
+				sorted_chunk.Reset();
+				scanner.Scan(sorted_chunk);
+				chunk_offset = 0;
+				if (sorted_chunk.size() == 0) {
+					throw InternalException("Mismatch in sorted row count in RowGroupCollection::SortRowGroups");
+				}
+			}
+			auto count = MinValue<idx_t>(row_group_count - append_count, sorted_chunk.size() - chunk_offset);
+			append_chunk.Reference(sorted_chunk);
+			if (count < sorted_chunk.size()) {
+				append_chunk.Slice(chunk_offset, count);
+			}
+			new_row_group->Append(append_state.row_group_append_state, append_chunk, count);
+			append_count += count;
+			chunk_offset += count;
+		}
+		new_row_group->Verify();
+		segments.push_back(SegmentNode<RowGroup> {row_group_start, std::move(new_row_group)});
+		row_group_start += row_group_count;
+		remaining -= row_group_count;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -894,6 +1111,8 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 	auto segments = row_groups->MoveSegments();
 	auto l = row_groups->Lock();
 
+	SortRowGroups(writer, segments);
+
 	CollectionCheckpointState checkpoint_state(*this, writer, segments, global_stats);
 
 	VacuumState vacuum_state;
@@ -976,6 +1195,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 	new_types.push_back(new_column.GetType());
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
+	result->unsorted_row_start = unsorted_row_start.load();
 
 	DataChunk dummy_chunk;
 	Vector default_vector(new_column.GetType());
@@ -1003,6 +1223,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
 
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
+	result->unsorted_row_start = unsorted_row_start.load();
 	result->stats.InitializeRemoveColumn(stats, col_idx);
 
 	for (auto &current_row_group : row_groups->Segments()) {
@@ -1021,6 +1242,11 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &cont
 
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
+	result->unsorted_row_start = unsorted_row_start.load();
+	if (IsSortKey(changed_idx)) {
+		// the new type might have a different sort order
+		result->unsorted_row_start = row_start;
+	}
 	result->stats.InitializeAlterType(stats, changed_idx, target_type);
 
 	vector<LogicalType> scan_types;
@@ -1106,4 +1332,14 @@ void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStat
 	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
 }
 
+unique_ptr<HistogramStatistics> RowGroupCollection::CopyHistogram(column_t column_id) {
+	return stats.CopyHistogram(column_id);
+}
+
+void RowGroupCollection::SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	auto stats_lock = stats.GetLock();
+	stats.GetStats(*stats_lock, column_id).SetHistogram(std::move(histogram));
+}
+
 } // namespace duckdb
@@ -109,6 +109,14 @@ unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 	return result.ToUnique();
 }
 
+unique_ptr<HistogramStatistics> TableStatistics::CopyHistogram(idx_t i) {
+	lock_guard<mutex> l(*stats_lock);
+	if (!column_stats[i]->HasHistogram()) {
+		return nullptr;
+	}
+	return column_stats[i]->Histogram().Copy();
+}
+
 void TableStatistics::CopyStats(TableStatistics &other) {
 	TableStatisticsLock lock(*stats_lock);
 	CopyStats(lock, other);
@@ -1,6 +1,10 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -8,10 +12,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +63,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +70,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +98,26 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static idx_t GetSlotSize(DatabaseInstance &db, TemporaryBufferSize size) {
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	}
+	return static_cast<idx_t>(size);
+}
+
+static string GetTemporaryFileName(TemporaryBufferSize size, idx_t index) {
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	return "duckdb_temp_storage_S" + to_string(static_cast<idx_t>(size) / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+                                         idx_t index, TemporaryBufferSize size, TemporaryFileManager &manager)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index), size(size),
+      slot_size(GetSlotSize(db, size)),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(size, index))),
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -114,20 +133,49 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	CreateFileIfNotExists(lock);
 	// fetch a new block index to write to
 	auto block_index = index_manager.GetNewBlockIndex();
-	return TemporaryFileIndex(file_index, block_index);
+	return TemporaryFileIndex(size, file_index, block_index);
 }
 
 void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
+	D_ASSERT(size == TemporaryBufferSize::DEFAULT);
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
 	buffer.Write(*handle, GetPositionInFile(index.block_index));
 }
 
+void TemporaryFileHandle::WriteTemporaryFile(AllocatedData &compressed_buffer, TemporaryFileIndex index) {
+	D_ASSERT(size != TemporaryBufferSize::DEFAULT);
+	D_ASSERT(compressed_buffer.GetSize() >= slot_size);
+	handle->Write(compressed_buffer.get(), slot_size, GetPositionInFile(index.block_index));
+}
+
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle,
+		                                                          GetPositionInFile(block_index),
+		                                                          buffer_manager.GetBlockSize(),
+		                                                          std::move(reusable_buffer));
+	}
+
+	// read the compressed slot: the compressed size followed by the compressed data
+	auto compressed_buffer = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_buffer.get(), slot_size, GetPositionInFile(block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	if (compressed_size > slot_size - sizeof(idx_t)) {
+		throw IOException("Corrupt compressed block in temporary file \"%s\"", path);
+	}
+
+	// decompress directly into the internal buffer of the result
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto decompressed_size =
+	    duckdb_zstd::ZSTD_decompress(buffer->InternalBuffer(), buffer->AllocSize(),
+	                                 compressed_buffer.get() + sizeof(idx_t), compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress block from temporary file \"%s\"", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -181,7 +229,60 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
+}
+
+//===--------------------------------------------------------------------===//
+// TemporaryFileCompressionAdaptivity
+//===--------------------------------------------------------------------===//
+
+TemporaryFileCompressionAdaptivity::TemporaryFileCompressionAdaptivity() : best_level(0), write_count(0) {
+	for (idx_t level_idx = 0; level_idx < LEVEL_COUNT; level_idx++) {
+		average_time[level_idx] = 0;
+	}
+}
+
+int TemporaryFileCompressionAdaptivity::GetZSTDLevel(idx_t level_idx) {
+	switch (level_idx) {
+	case 0:
+		return -5;
+	case 1:
+		return -3;
+	case 2:
+		return 1;
+	case 3:
+		return 3;
+	default:
+		throw InternalException("Invalid level index in TemporaryFileCompressionAdaptivity::GetZSTDLevel");
+	}
+}
+
+idx_t TemporaryFileCompressionAdaptivity::GetLevelIndex() {
+	lock_guard<mutex> guard(lock);
+	write_count++;
+	if (write_count % EXPLORATION_INTERVAL != 0) {
+		return best_level;
+	}
+	// explore one of the levels adjacent to the best one, alternating between the lower and the higher one
+	if ((write_count / EXPLORATION_INTERVAL) % 2 == 0) {
+		return best_level == 0 ? best_level + 1 : best_level - 1;
+	}
+	return best_level + 1 == LEVEL_COUNT ? best_level - 1 : best_level + 1;
+}
+
+void TemporaryFileCompressionAdaptivity::Update(idx_t level_idx, double elapsed) {
+	static constexpr double ALPHA = 0.25;
+	D_ASSERT(level_idx < LEVEL_COUNT);
+	lock_guard<mutex> guard(lock);
+	auto &average = average_time[level_idx];
+	average = average == 0 ? elapsed : ALPHA * elapsed + (1 - ALPHA) * average;
+	// levels that have not been tried yet have an average of 0, so they will be tried first
+	best_level = 0;
+	for (idx_t i = 1; i < LEVEL_COUNT; i++) {
+		if (average_time[i] < average_time[best_level]) {
+			best_level = i;
+		}
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -240,8 +341,8 @@ TemporaryFileManager &TemporaryDirectoryHandle::GetTempFile() {
 // TemporaryFileIndex
 //===--------------------------------------------------------------------===//
 
-TemporaryFileIndex::TemporaryFileIndex(idx_t file_index, idx_t block_index)
-    : file_index(file_index), block_index(block_index) {
+TemporaryFileIndex::TemporaryFileIndex(TemporaryBufferSize size, idx_t file_index, idx_t block_index)
+    : size(size), file_index(file_index), block_index(block_index) {
 }
 
 bool TemporaryFileIndex::IsValid() const {
@@ -274,41 +375,94 @@ TemporaryFileManager::~TemporaryFileManager() {
 	files.clear();
 }
 
+TemporaryBufferSize TemporaryFileManager::CompressBuffer(idx_t level_idx, FileBuffer &buffer,
+                                                         AllocatedData &compressed_buffer) {
+	if (buffer.AllocSize() != DEFAULT_BLOCK_ALLOC_SIZE) {
+		// the compressed slot sizes assume the default block allocation size
+		return TemporaryBufferSize::DEFAULT;
+	}
+	// the largest compressed slot: if the block does not fit, compression is not worth it
+	static constexpr idx_t MAX_COMPRESSED_SIZE = static_cast<idx_t>(TemporaryBufferSize::S224K);
+	static constexpr idx_t SLOT_SIZE_GRANULARITY = static_cast<idx_t>(TemporaryBufferSize::S32K);
+
+	compressed_buffer = Allocator::Get(db).Allocate(MAX_COMPRESSED_SIZE);
+	auto compressed_size = duckdb_zstd::ZSTD_compress(
+	    compressed_buffer.get() + sizeof(idx_t), MAX_COMPRESSED_SIZE - sizeof(idx_t), buffer.InternalBuffer(),
+	    buffer.AllocSize(), TemporaryFileCompressionAdaptivity::GetZSTDLevel(level_idx));
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		// the compressed block does not fit in the largest slot
+		return TemporaryBufferSize::DEFAULT;
+	}
+	// prefix the compressed data with its size, and zero-initialize the remainder of the slot
+	Store<idx_t>(compressed_size, compressed_buffer.get());
+	auto used_size = sizeof(idx_t) + compressed_size;
+	auto slot_size = AlignValue<idx_t, SLOT_SIZE_GRANULARITY>(used_size);
+	memset(compressed_buffer.get() + used_size, 0, slot_size - used_size);
+	return static_cast<TemporaryBufferSize>(slot_size);
+}
+
+TemporaryFileIndex TemporaryFileManager::GetFreeSlot(TemporaryBufferSize size, block_id_t block_id,
+                                                     TemporaryFileHandle *&handle) {
+	TemporaryManagerLock lock(manager_lock);
+	TemporaryFileIndex index;
+	handle = nullptr;
+	// first check if we can write to an open existing file
+	auto &size_files = files[size];
+	for (auto &entry : size_files) {
+		auto &temp_file = entry.second;
+		index = temp_file->TryGetBlockIndex();
+		if (index.IsValid()) {
+			handle = entry.second.get();
+			break;
+		}
+	}
+	if (!handle) {
+		// no existing handle to write to; we need to create & open a new file
+		auto &index_manager = index_managers[size];
+		auto new_file_index = index_manager.GetNewBlockIndex();
+		auto new_file =
+		    make_uniq<TemporaryFileHandle>(size_files.size(), db, temp_directory, new_file_index, size, *this);
+		handle = new_file.get();
+		size_files[new_file_index] = std::move(new_file);
+
+		index = handle->TryGetBlockIndex();
+	}
+	D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
+	used_blocks[block_id] = index;
+	return index;
+}
+
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
-
-	{
-		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
-		for (auto &entry : files) {
-			auto &temp_file = entry.second;
-			index = temp_file->TryGetBlockIndex();
-			if (index.IsValid()) {
-				handle = entry.second.get();
-				break;
-			}
-		}
-		if (!handle) {
-			// no existing handle to write to; we need to create & open a new file
-			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
-			handle = new_file.get();
-			files[new_file_index] = std::move(new_file);
-
-			index = handle->TryGetBlockIndex();
-		}
-		D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
-		used_blocks[block_id] = index;
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		auto index = GetFreeSlot(TemporaryBufferSize::DEFAULT, block_id, handle);
+		D_ASSERT(handle);
+		D_ASSERT(index.IsValid());
+		handle->WriteTemporaryFile(buffer, index);
+		return;
 	}
+
+	// compress the block, and write it to the smallest slot it fits in
+	Profiler profiler;
+	profiler.Start();
+	auto level_idx = compression_adaptivity.GetLevelIndex();
+	AllocatedData compressed_buffer;
+	auto size = CompressBuffer(level_idx, buffer, compressed_buffer);
+	auto index = GetFreeSlot(size, block_id, handle);
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (size == TemporaryBufferSize::DEFAULT) {
+		handle->WriteTemporaryFile(buffer, index);
+	} else {
+		handle->WriteTemporaryFile(compressed_buffer, index);
+	}
+	profiler.End();
+	compression_adaptivity.Update(level_idx, profiler.Elapsed());
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -372,7 +526,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 	{
 		TemporaryManagerLock lock(manager_lock);
 		index = GetTempBlockIndex(lock, id);
-		handle = GetFileHandle(lock, index.file_index);
+		handle = GetFileHandle(lock, index);
 	}
 	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
 	{
@@ -386,15 +540,17 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 void TemporaryFileManager::DeleteTemporaryBuffer(block_id_t id) {
 	TemporaryManagerLock lock(manager_lock);
 	auto index = GetTempBlockIndex(lock, id);
-	auto handle = GetFileHandle(lock, index.file_index);
+	auto handle = GetFileHandle(lock, index);
 	EraseUsedBlock(lock, id, handle, index);
 }
 
 vector<TemporaryFileInformation> TemporaryFileManager::GetTemporaryFiles() {
 	lock_guard<mutex> lock(manager_lock);
 	vector<TemporaryFileInformation> result;
-	for (auto &file : files) {
-		result.push_back(file.second->GetTemporaryFile());
+	for (auto &size_files : files) {
+		for (auto &file : size_files.second) {
+			result.push_back(file.second->GetTemporaryFile());
+		}
 	}
 	return result;
 }
@@ -408,13 +564,13 @@ void TemporaryFileManager::EraseUsedBlock(TemporaryManagerLock &lock, block_id_t
 	used_blocks.erase(entry);
 	handle->EraseBlockIndex(NumericCast<block_id_t>(index.block_index));
 	if (handle->DeleteIfEmpty()) {
-		EraseFileHandle(lock, index.file_index);
+		EraseFileHandle(lock, index);
 	}
 }
 
 // FIXME: returning a raw pointer???
-TemporaryFileHandle *TemporaryFileManager::GetFileHandle(TemporaryManagerLock &, idx_t index) {
-	return files[index].get();
+TemporaryFileHandle *TemporaryFileManager::GetFileHandle(TemporaryManagerLock &, TemporaryFileIndex index) {
+	return files[index.size][index.file_index].get();
 }
 
 TemporaryFileIndex TemporaryFileManager::GetTempBlockIndex(TemporaryManagerLock &, block_id_t id) {
@@ -422,9 +578,9 @@ TemporaryFileIndex TemporaryFileManager::GetTempBlockIndex(TemporaryManagerLock
 	return used_blocks[id];
 }
 
-void TemporaryFileManager::EraseFileHandle(TemporaryManagerLock &, idx_t file_index) {
-	files.erase(file_index);
-	index_manager.RemoveIndex(file_index);
+void TemporaryFileManager::EraseFileHandle(TemporaryManagerLock &, TemporaryFileIndex index) {
+	files[index.size].erase(index.file_index);
+	index_managers[index.size].RemoveIndex(index.file_index);
 }
 
 } // namespace duckdb
@@ -1,5 +1,6 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include "duckdb/common/exception.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -8,9 +9,24 @@
 
 namespace duckdb {
 
+TemporaryMemoryQuery::TemporaryMemoryQuery(ClientContext &context_p, string query_p)
+    : context(context_p), query(std::move(query_p)), memory_limit(NumericLimits<idx_t>::Maximum()),
+      estimated_memory(0), waiting(false), admitted(false), wait_time(0), state_count(0), reservation(0),
+      remaining_size(0) {
+}
+
+TemporaryMemoryAdmission::TemporaryMemoryAdmission(TemporaryMemoryManager &temporary_memory_manager_p,
+                                                   TemporaryMemoryQuery &query_p)
+    : temporary_memory_manager(temporary_memory_manager_p), query(query_p) {
+}
+
+TemporaryMemoryAdmission::~TemporaryMemoryAdmission() {
+	temporary_memory_manager.ReleaseAdmission(query);
+}
+
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+                                           TemporaryMemoryQuery &query_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), query(query_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0), materialization_penalty(1) {
 }
 
@@ -62,6 +78,12 @@ void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_s
 	SetRemainingSize(temporary_memory_state, 0);
 	active_states.erase(temporary_memory_state);
 
+	auto &query = temporary_memory_state.query;
+	D_ASSERT(query.state_count > 0);
+	query.state_count--;
+	ReleaseQuery(query);
+	memory_released.notify_all();
+
 	Verify();
 }
 
@@ -83,10 +105,14 @@ TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
 unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext &context) {
 	auto guard = Lock();
 	UpdateConfiguration(context);
+	auto &query = GetOrCreateQuery(context, context.GetCurrentQuery());
 
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	// the minimum reservation also respects the memory limit of the query
+	minimum_reservation = MinValue(minimum_reservation, query.memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, query, minimum_reservation));
+	query.state_count++;
 	SetRemainingSize(*result, result->GetMinimumReservation());
 	SetReservation(*result, result->GetMinimumReservation());
 	active_states.insert(*result);
@@ -95,6 +121,98 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	return result;
 }
 
+unique_ptr<TemporaryMemoryAdmission> TemporaryMemoryManager::AdmitQuery(ClientContext &context, const string &query_p,
+                                                                        idx_t estimated_memory) {
+	auto guard = Lock();
+	UpdateConfiguration(context);
+	auto &query = GetOrCreateQuery(context, query_p);
+	D_ASSERT(!query.admitted && !query.waiting);
+	query.estimated_memory = MinValue(estimated_memory, MinValue(query.memory_limit, memory_limit));
+	query.waiting = true;
+	query.wait_start = high_resolution_clock::now();
+	const auto timeout_ms = ClientConfig::GetConfig(context).query_admission_timeout;
+	const auto timeout = milliseconds(NumericCast<int64_t>(timeout_ms));
+	while (!CanAdmit(query)) {
+		if (context.interrupted) {
+			query.waiting = false;
+			ReleaseQuery(query);
+			throw InterruptException();
+		}
+		if (high_resolution_clock::now() - query.wait_start >= timeout) {
+			// give up rather than waiting forever on queries that might never release their memory
+			const auto query_estimate = query.estimated_memory;
+			query.waiting = false;
+			ReleaseQuery(query);
+			throw OutOfMemoryException("Query was not admitted within the query_admission_timeout of %llu ms: it is "
+			                           "estimated to need %s, which does not fit next to the running queries",
+			                           timeout_ms, StringUtil::BytesToHumanReadableString(query_estimate));
+		}
+		// wait for running queries to release memory
+		memory_released.wait_for(guard, milliseconds(ADMISSION_POLL_INTERVAL_MS));
+		UpdateConfiguration(context);
+	}
+	query.waiting = false;
+	query.admitted = true;
+	query.wait_time = duration_cast<duration<double>>(high_resolution_clock::now() - query.wait_start).count();
+	return unique_ptr<TemporaryMemoryAdmission>(new TemporaryMemoryAdmission(*this, query));
+}
+
+vector<TemporaryMemoryQuery> TemporaryMemoryManager::GetQueries() {
+	auto guard = Lock();
+	vector<TemporaryMemoryQuery> result;
+	auto now = high_resolution_clock::now();
+	for (auto &entry : queries) {
+		result.push_back(entry.second);
+		auto &query = result.back();
+		if (query.waiting) {
+			query.wait_time = duration_cast<duration<double>>(now - query.wait_start).count();
+		}
+	}
+	return result;
+}
+
+TemporaryMemoryQuery &TemporaryMemoryManager::GetOrCreateQuery(ClientContext &context, const string &query) {
+	auto entry = queries.find(context);
+	if (entry == queries.end()) {
+		entry = queries.emplace(context, TemporaryMemoryQuery(context, query)).first;
+	}
+	entry->second.memory_limit = ClientConfig::GetConfig(context).query_memory_limit;
+	return entry->second;
+}
+
+void TemporaryMemoryManager::ReleaseQuery(TemporaryMemoryQuery &query) {
+	if (query.state_count != 0 || query.admitted || query.waiting) {
+		return;
+	}
+	D_ASSERT(query.reservation == 0 && query.remaining_size == 0);
+	queries.erase(query.context);
+}
+
+void TemporaryMemoryManager::ReleaseAdmission(TemporaryMemoryQuery &query) {
+	auto guard = Lock();
+	D_ASSERT(query.admitted);
+	query.admitted = false;
+	ReleaseQuery(query);
+	memory_released.notify_all();
+}
+
+bool TemporaryMemoryManager::CanAdmit(const TemporaryMemoryQuery &query) const {
+	if (query.estimated_memory <= memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR) {
+		// small queries are never held back by large ones
+		return true;
+	}
+	// the memory of the running queries is their estimate, or their actual reservation if it is larger
+	idx_t running_memory = 0;
+	for (auto &entry : queries) {
+		auto &running = entry.second;
+		if (!running.waiting) {
+			running_memory += MaxValue(running.estimated_memory, running.reservation);
+		}
+	}
+	// a query is always admitted if nothing else is running, even if its estimate exceeds the memory limit
+	return running_memory == 0 || running_memory + query.estimated_memory <= memory_limit;
+}
+
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
 
@@ -119,7 +237,13 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// 1. Remaining size of the state
 		// 2. The max memory per query
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
+		// 4. The memory that is left of the memory limit of the query
 		auto upper_bound = MinValue<idx_t>(temporary_memory_state.GetRemainingSize(), query_max_memory);
+		auto &query = temporary_memory_state.query;
+		const auto query_reservation = query.reservation - temporary_memory_state.GetReservation();
+		const auto query_remaining =
+		    query.memory_limit > query_reservation ? query.memory_limit - query_reservation : 0;
+		upper_bound = MinValue<idx_t>(upper_bound, query_remaining);
 		const auto free_memory = memory_limit - (reservation - temporary_memory_state.GetReservation());
 		upper_bound = MinValue<idx_t>(
 		    upper_bound, LossyNumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * static_cast<double>(free_memory)));
@@ -144,15 +268,19 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size) {
 	D_ASSERT(this->remaining_size >= temporary_memory_state.GetRemainingSize());
 	this->remaining_size -= temporary_memory_state.GetRemainingSize();
+	temporary_memory_state.query.remaining_size -= temporary_memory_state.GetRemainingSize();
 	temporary_memory_state.remaining_size = new_remaining_size;
 	this->remaining_size += temporary_memory_state.GetRemainingSize();
+	temporary_memory_state.query.remaining_size += temporary_memory_state.GetRemainingSize();
 }
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
 	D_ASSERT(this->reservation >= temporary_memory_state.GetReservation());
 	this->reservation -= temporary_memory_state.GetReservation();
+	temporary_memory_state.query.reservation -= temporary_memory_state.GetReservation();
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.GetReservation();
+	temporary_memory_state.query.reservation += temporary_memory_state.GetReservation();
 }
 
 idx_t TemporaryMemoryManager::ComputeOptimalReservation(const TemporaryMemoryState &temporary_memory_state,
@@ -6,6 +6,8 @@
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/printer.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
@@ -31,6 +33,15 @@
 
 namespace duckdb {
 
+//! The appends to a single table that have not been replayed yet
+struct ReplayTableAppend {
+	explicit ReplayTableAppend(TableCatalogEntry &table) : table(table) {
+	}
+
+	reference<TableCatalogEntry> table;
+	vector<unique_ptr<DataChunk>> chunks;
+};
+
 class ReplayState {
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
@@ -42,6 +53,24 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+
+public:
+	//! Buffer a chunk that is appended to a table - the buffered appends are replayed by FlushAppends
+	void AppendChunk(TableCatalogEntry &table, unique_ptr<DataChunk> chunk);
+	//! Replay all buffered appends
+	void FlushAppends();
+
+private:
+	//! Replay the buffered appends to a single table
+	void ReplayAppend(ReplayTableAppend &append);
+
+private:
+	//! The buffered appends, per table
+	vector<ReplayTableAppend> pending_appends;
+	//! Maps a table to its entry in pending_appends
+	reference_map_t<TableCatalogEntry, idx_t> pending_tables;
+	//! The total number of buffered rows
+	idx_t pending_rows = 0;
 };
 
 class WriteAheadLogDeserializer {
@@ -99,8 +128,17 @@ public:
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
+			if (!DeserializeOnly()) {
+				// the transaction is committed after this entry: replay any remaining appends
+				state.FlushAppends();
+			}
 			return true;
 		}
+		if (DeserializeOnly() && data && IsDataEntry(wal_type)) {
+			// the entry was read (and its checksum verified) into a separate buffer
+			// we are only looking for the checkpoint flag - so we can skip deserializing the data of the entry
+			return false;
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -111,6 +149,11 @@ public:
 	}
 
 protected:
+	static bool IsDataEntry(WALType wal_type) {
+		return wal_type == WALType::INSERT_TUPLE || wal_type == WALType::DELETE_TUPLE ||
+		       wal_type == WALType::UPDATE_TUPLE;
+	}
+
 	void ReplayEntry(WALType wal_type);
 
 	void ReplayVersion();
@@ -158,6 +201,54 @@ private:
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Replay Appends
+//===--------------------------------------------------------------------===//
+//! The number of buffered rows after which the buffered appends are replayed
+static constexpr idx_t WAL_REPLAY_BUFFERED_ROWS = 8 * Storage::ROW_GROUP_SIZE;
+
+void ReplayState::AppendChunk(TableCatalogEntry &table, unique_ptr<DataChunk> chunk) {
+	auto entry = pending_tables.find(table);
+	idx_t append_idx;
+	if (entry == pending_tables.end()) {
+		append_idx = pending_appends.size();
+		pending_appends.emplace_back(table);
+		pending_tables.insert(make_pair(reference<TableCatalogEntry>(table), append_idx));
+	} else {
+		append_idx = entry->second;
+	}
+	pending_rows += chunk->size();
+	pending_appends[append_idx].chunks.push_back(std::move(chunk));
+	if (pending_rows >= WAL_REPLAY_BUFFERED_ROWS) {
+		FlushAppends();
+	}
+}
+
+void ReplayState::ReplayAppend(ReplayTableAppend &append) {
+	// append to the table using a single append state for all buffered chunks
+	// we don't do any constraint verification here
+	auto &table = append.table.get();
+	auto &storage = table.GetStorage();
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	LocalAppendState append_state;
+	storage.InitializeLocalAppend(append_state, table, context, bound_constraints);
+	for (auto &chunk : append.chunks) {
+		storage.LocalAppend(append_state, table, context, *chunk);
+		chunk.reset();
+	}
+	storage.FinalizeLocalAppend(append_state);
+}
+
+void ReplayState::FlushAppends() {
+	// the appends all go through the local storage of the single replay transaction - replay them one table at a time
+	for (auto &append : pending_appends) {
+		ReplayAppend(append);
+	}
+	pending_appends.clear();
+	pending_tables.clear();
+	pending_rows = 0;
+}
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
@@ -169,6 +260,11 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		// WAL is empty
 		return false;
 	}
+	Profiler profiler;
+	profiler.Start();
+	auto &replay_statistics = database.GetStorageManager().GetReplayStatistics();
+	replay_statistics = WALReplayStatistics();
+	replay_statistics.wal_size = reader.FileSize();
 
 	con.BeginTransaction();
 	MetaTransaction::Get(*con.context).ModifyDatabase(database);
@@ -202,6 +298,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		if (manager.IsCheckpointClean(checkpoint_state.checkpoint_id)) {
 			// the contents of the WAL have already been checkpointed
 			// we can safely truncate the WAL and ignore its contents
+			replay_statistics.replay_time = profiler.Elapsed();
 			return true;
 		}
 	}
@@ -221,6 +318,8 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
 			if (deserializer.ReplayEntry()) {
 				con.Commit();
+				replay_statistics.replayed_bytes = reader.CurrentOffset();
+				replay_statistics.replayed_transactions++;
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -245,6 +344,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
+	replay_statistics.replay_time = profiler.Elapsed();
 	return false;
 }
 
@@ -252,6 +352,10 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 // Replay Entries
 //===--------------------------------------------------------------------===//
 void WriteAheadLogDeserializer::ReplayEntry(WALType entry_type) {
+	if (!DeserializeOnly() && entry_type != WALType::INSERT_TUPLE && entry_type != WALType::USE_TABLE) {
+		// any other entry might depend on the appends replayed so far: replay them first
+		state.FlushAppends();
+	}
 	switch (entry_type) {
 	case WALType::WAL_VERSION:
 		ReplayVersion();
@@ -639,8 +743,8 @@ void WriteAheadLogDeserializer::ReplayUseTable() {
 }
 
 void WriteAheadLogDeserializer::ReplayInsert() {
-	DataChunk chunk;
-	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
+	auto chunk = make_uniq<DataChunk>();
+	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk->Deserialize(object); });
 	if (DeserializeOnly()) {
 		return;
 	}
@@ -648,10 +752,8 @@ void WriteAheadLogDeserializer::ReplayInsert() {
 		throw InternalException("Corrupt WAL: insert without table");
 	}
 
-	// append to the current table
-	// we don't do any constraint verification here
-	vector<unique_ptr<BoundConstraint>> bound_constraints;
-	state.current_table->GetStorage().LocalAppend(*state.current_table, context, chunk, bound_constraints);
+	// buffer the append to the current table
+	state.AppendChunk(*state.current_table, std::move(chunk));
 }
 
 void WriteAheadLogDeserializer::ReplayDelete() {
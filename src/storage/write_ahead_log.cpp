@@ -14,6 +14,7 @@
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 
 namespace duckdb {
@@ -37,6 +38,11 @@ BufferedFileWriter &WriteAheadLog::Initialize() {
 		                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE |
 		                                           FileFlags::FILE_FLAGS_APPEND);
 		wal_size = writer->GetFileSize();
+		{
+			// anything already in the file is considered durable
+			lock_guard<mutex> guard(sync_lock);
+			synced_size = wal_size;
+		}
 		initialized = true;
 	}
 	return *writer;
@@ -67,6 +73,10 @@ void WriteAheadLog::Truncate(idx_t size) {
 	}
 	writer->Truncate(size);
 	wal_size = writer->GetFileSize();
+
+	lock_guard<mutex> guard(sync_lock);
+	synced_size = MinValue<idx_t>(synced_size, size);
+	truncated_size = MinValue<idx_t>(truncated_size, size);
 }
 
 void WriteAheadLog::Delete() {
@@ -77,6 +87,10 @@ void WriteAheadLog::Delete() {
 	auto &fs = FileSystem::Get(database);
 	fs.RemoveFile(wal_path);
 	wal_size = 0;
+
+	lock_guard<mutex> guard(sync_lock);
+	synced_size = 0;
+	truncated_size = 0;
 }
 
 //===--------------------------------------------------------------------===//
@@ -397,14 +411,75 @@ void WriteAheadLog::Flush() {
 	if (!writer) {
 		return;
 	}
+	SyncUpTo(WriteFlush());
+}
+
+idx_t WriteAheadLog::WriteFlush() {
+	if (!writer) {
+		return 0;
+	}
 
 	// write an empty entry
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
 
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
+	// write all changes made to the WAL to the file
+	writer->Flush();
 	wal_size = writer->GetFileSize();
+	return wal_size;
+}
+
+void WriteAheadLog::SyncUpTo(idx_t size) {
+	if (!writer) {
+		return;
+	}
+	Profiler profiler;
+	profiler.Start();
+
+	unique_lock<mutex> guard(sync_lock);
+	pending_syncs++;
+	while (synced_size < size) {
+		if (sync_in_progress) {
+			// another thread is syncing the WAL - wait for it to finish, it might have synced our entries as well
+			sync_finished.wait(guard);
+			continue;
+		}
+		// we sync the WAL on behalf of everyone that is waiting
+		// everything up to the current size has been written to the file, so the sync makes all of it durable
+		sync_in_progress = true;
+		idx_t sync_target = wal_size;
+		truncated_size = sync_target;
+		sync_statistics.sync_count++;
+		sync_statistics.max_batch_size = MaxValue<idx_t>(sync_statistics.max_batch_size, pending_syncs);
+
+		guard.unlock();
+		try {
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			pending_syncs--;
+			sync_finished.notify_all();
+			throw;
+		}
+		guard.lock();
+		sync_in_progress = false;
+		// if the WAL was truncated while we were syncing, only the part before the truncation is known to be durable
+		synced_size = MaxValue<idx_t>(synced_size, MinValue<idx_t>(sync_target, truncated_size));
+		sync_finished.notify_all();
+	}
+	pending_syncs--;
+
+	profiler.End();
+	auto elapsed = profiler.Elapsed();
+	sync_statistics.commit_count++;
+	sync_statistics.total_commit_wait += elapsed;
+	sync_statistics.max_commit_wait = MaxValue<double>(sync_statistics.max_commit_wait, elapsed);
+}
+
+WALSyncStatistics WriteAheadLog::GetSyncStatistics() {
+	lock_guard<mutex> guard(sync_lock);
+	return sync_statistics;
 }
 
 } // namespace duckdb
@@ -198,6 +198,8 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 		storage->Commit();
 		commit_state = storage_manager.GenStorageCommitState(*log);
 		undo_buffer.WriteToWAL(*log);
+		// write the flush marker: the commit is synced to disk before it becomes visible to other transactions
+		commit_state->FlushCommit();
 	} catch (std::exception &ex) {
 		if (commit_state) {
 			commit_state->RevertCommit();
@@ -225,15 +227,12 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 	try {
 		storage->Commit();
 		undo_buffer.Commit(iterator_state, commit_id);
-		if (commit_state) {
-			// if we have written to the WAL - flush after the commit has been successful
-			commit_state->FlushCommit();
-		}
 		return ErrorData();
 	} catch (std::exception &ex) {
 		undo_buffer.RevertCommit(iterator_state, this->transaction_id);
 		if (commit_state) {
 			// if we have written to the WAL - truncate the WAL on failure
+			// note that a commit that has already been flushed to the WAL cannot be reverted anymore
 			commit_state->RevertCommit();
 		}
 		return ErrorData(ex);
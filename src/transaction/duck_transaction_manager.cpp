@@ -13,6 +13,9 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -225,8 +228,8 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	auto undo_properties = transaction.GetUndoProperties();
 	auto checkpoint_decision = CanCheckpoint(transaction, lock, undo_properties);
 	ErrorData error;
-	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
+	bool wal_synced = false;
 	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
@@ -241,9 +244,28 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		}
 		// unlock the transaction lock while we write to the WAL
 		tlock.unlock();
-		// grab the WAL lock and hold it until the entire commit is finished
-		held_wal_lock = make_uniq<lock_guard<mutex>>(wal_lock);
-		error = transaction.WriteToWAL(db, commit_state);
+		auto log = db.GetStorageManager().GetWAL();
+		idx_t sync_size = 0;
+		{
+			lock_guard<mutex> wal_guard(wal_lock);
+			error = transaction.WriteToWAL(db, commit_state);
+			sync_size = log->GetWALSize();
+		}
+		if (!error.HasError()) {
+			// the changes must be durable before they become visible to other transactions
+			// we sync the WAL without holding the WAL lock: other transactions can write their changes to the WAL
+			// while the sync is in progress, so that the commits of concurrent transactions are made durable by a
+			// single sync (group commit)
+			// this transaction holds on to its write lock until it is removed, so the WAL cannot be checkpointed away
+			try {
+				log->SyncUpTo(sync_size);
+				wal_synced = true;
+			} catch (std::exception &ex) {
+				// the flushed commit can no longer be removed from the WAL
+				error = ErrorData(ex);
+				ValidChecker::Invalidate(db.GetDatabase(), "Failed to sync the WAL: " + error.RawMessage());
+			}
+		}
 
 		// after we finish writing to the WAL we grab the transaction lock again
 		tlock.lock();
@@ -253,6 +275,11 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
 		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		if (error.HasError() && wal_synced) {
+			// the commit is durable in the WAL, but could not be applied in memory
+			ValidChecker::Invalidate(db.GetDatabase(), "Failed to commit a transaction that was written to the WAL: " +
+			                                               error.RawMessage());
+		}
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
@@ -264,6 +291,10 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		if (transaction.catalog_version >= TRANSACTION_ID_START) {
 			transaction.catalog_version = ++last_committed_version;
 		}
+		// drop any cached query results that read from the tables modified by this transaction
+		if (transaction.ChangesMade()) {
+			QueryResultCache::Get(db.GetDatabase()).Invalidate();
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -237,3 +237,65 @@ TEST_CASE("Test Pending Query Prepared Statements API", "[api][.]") {
 		REQUIRE_THROWS(pending_query->Execute());
 	}
 }
+
+TEST_CASE("Test query admission control with pending queries", "[api][.]") {
+	DuckDB db;
+	Connection con(db);
+	Connection con2(db);
+	Connection monitor(db);
+	REQUIRE_NO_FAIL(con.Query("SET temp_directory='" + TestCreatePath("query_admission_control") + "'"));
+	// the query is estimated to need more than half of the memory limit
+	REQUIRE_NO_FAIL(con.Query("SET memory_limit='40MB'"));
+	REQUIRE_NO_FAIL(con.Query("SET query_admission_control=true"));
+	string query = "SELECT COUNT(*), SUM(c) FROM (SELECT i, COUNT(*) AS c FROM range(2000000) t(i) GROUP BY i)";
+
+	// the reservation of a query is capped at its memory limit while it runs
+	REQUIRE_NO_FAIL(con.Query("SET query_memory_limit='32MiB'"));
+	auto pending_query = con.PendingQuery(query);
+	REQUIRE(!pending_query->HasError());
+	int64_t max_reservation = 0;
+	while (true) {
+		auto reservations = monitor.Query("SELECT reservation_bytes FROM duckdb_memory_reservations() "
+		                                  "WHERE memory_limit_bytes=32*1024*1024");
+		REQUIRE(!reservations->HasError());
+		for (idx_t row = 0; row < reservations->RowCount(); row++) {
+			auto reservation = reservations->GetValue(0, row).GetValue<int64_t>();
+			REQUIRE(reservation <= 32 * 1024 * 1024);
+			max_reservation = MaxValue(max_reservation, reservation);
+		}
+		if (PendingQueryResult::IsResultReady(pending_query->ExecuteTask())) {
+			break;
+		}
+	}
+	REQUIRE(max_reservation > 0);
+	auto result = pending_query->Execute();
+	REQUIRE(CHECK_COLUMN(result, 0, {2000000}));
+	REQUIRE_NO_FAIL(con.Query("RESET query_memory_limit"));
+
+	// a pending query keeps its admission until it is executed
+	pending_query = con.PendingQuery(query);
+	REQUIRE(!pending_query->HasError());
+
+	// a query that does not fit next to it fails once it waited for the admission timeout
+	REQUIRE_NO_FAIL(con2.Query("SET query_admission_timeout=100"));
+	result = con2.Query(query);
+	REQUIRE(result->HasError());
+	REQUIRE(StringUtil::Contains(result->GetError(), "query_admission_timeout"));
+	REQUIRE_NO_FAIL(con2.Query("RESET query_admission_timeout"));
+
+	// without a timeout, the query waits until the pending query is done
+	duckdb::unique_ptr<MaterializedQueryResult> waiting_result;
+	thread waiting_thread([&]() { waiting_result = con2.Query(query); });
+	bool waited = false;
+	for (idx_t i = 0; i < 1000 && !waited; i++) {
+		auto waiting =
+		    monitor.Query("SELECT COUNT(*) FROM duckdb_memory_reservations() WHERE status='waiting' AND wait_time > 0");
+		waited = !waiting->HasError() && waiting->GetValue(0, 0).GetValue<int64_t>() == 1;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	result = pending_query->Execute();
+	REQUIRE(CHECK_COLUMN(result, 0, {2000000}));
+	waiting_thread.join();
+	REQUIRE(waited);
+	REQUIRE(CHECK_COLUMN(waiting_result, 0, {2000000}));
+}
@@ -47,6 +47,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
+	    {"adaptive_reoptimization_threshold", {Value::DOUBLE(10)}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
 	    {"default_order", {"desc"}},
@@ -79,6 +80,9 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"extension_directory", {"test"}},
 	    {"max_expression_depth", {50}},
 	    {"max_memory", {"4.0 GiB"}},
+	    {"buffer_eviction_policy", {"2q"}},
+	    {"query_memory_limit", {"1.0 GiB"}},
+	    {"query_admission_timeout", {1000}},
 	    {"max_temp_directory_size", {"10.0 GiB"}},
 	    {"merge_join_threshold", {73}},
 	    {"nested_loop_join_threshold", {73}},
@@ -96,6 +100,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
+	    {"query_result_cache_size", {"4.0 GiB"}},
 	    {"temp_directory", {"tmp"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"force_bitpacking_mode", {"constant"}},
@@ -97,6 +97,42 @@ TEST_CASE("Test file operations", "[file_system]") {
 	fs->RemoveFile(fname);
 }
 
+TEST_CASE("Test batched file reads", "[file_system]") {
+	duckdb::unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	duckdb::unique_ptr<FileHandle> handle;
+	int64_t test_data[INTEGER_COUNT];
+	for (int i = 0; i < INTEGER_COUNT; i++) {
+		test_data[i] = i;
+	}
+
+	auto fname = TestCreatePath("test_file_batch");
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE));
+	REQUIRE_NOTHROW(handle->Write((void *)test_data, sizeof(int64_t) * INTEGER_COUNT, 0));
+	handle.reset();
+
+	// read three non-adjacent ranges of integers in a single batch
+	int64_t first[10], second[100], third[1];
+	duckdb::vector<FileReadRequest> requests;
+	requests.emplace_back(first, sizeof(first), 0);
+	requests.emplace_back(second, sizeof(second), sizeof(int64_t) * 200);
+	requests.emplace_back(third, sizeof(third), sizeof(int64_t) * (INTEGER_COUNT - 1));
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_READ));
+	REQUIRE_NOTHROW(handle->ReadBatch(requests));
+	for (int i = 0; i < 10; i++) {
+		REQUIRE(first[i] == i);
+	}
+	for (int i = 0; i < 100; i++) {
+		REQUIRE(second[i] == 200 + i);
+	}
+	REQUIRE(third[0] == INTEGER_COUNT - 1);
+
+	// reading past the end of the file fails
+	requests.emplace_back(first, sizeof(first), sizeof(int64_t) * (INTEGER_COUNT - 5));
+	REQUIRE_THROWS(handle->ReadBatch(requests));
+	handle.reset();
+	fs->RemoveFile(fname);
+}
+
 TEST_CASE("absolute paths", "[file_system]") {
 	duckdb::LocalFileSystem fs;
 